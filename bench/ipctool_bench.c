@@ -0,0 +1,419 @@
+/* ipctool_bench -- micro-benchmarks for ipctool's internal hot paths.
+ *
+ *   cmake --build build --target ipctool_bench
+ *   ./build/ipctool_bench [--reps N] [--filter NAME] [--mem-base ADDR]
+ *
+ * Every case runs over fixed, generated inputs, so numbers from two
+ * builds are comparable. A case is calibrated to a batch of calls taking
+ * about REP_MIN_NS, warmed up for WARMUP_REPS batches and then timed for
+ * --reps batches; the report has the per-call median, the median
+ * absolute deviation (MAD) and the minimum, plus MB/s for cases that
+ * process a buffer.
+ *
+ * The mem_reg() cases time the /dev/mem mapping, so they only run when
+ * --mem-base names a physical address range that is safe to read on this
+ * board; the "hop" case remaps the window on every call.
+ */
+
+#include <getopt.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "cjson/cJSON.h"
+#include "cjson/cYAML.h"
+#include "hashtable.h"
+#include "sha1.h"
+#include "tools.h"
+#include "uboot.h"
+
+#define BENCH_VERSION 1
+#define DEFAULT_REPS 15
+#define WARMUP_REPS 3
+#define REP_MIN_NS 20000000ULL
+#define MAX_REPS 1000
+
+#define BUF_BYTES (1 << 20)
+#define SHA1_BYTES (64 << 10)
+#define HT_KEYS 1024
+// two 64 KiB windows of mem_reg() apart
+#define MEM_HOP 0x20000
+
+static unsigned char *buf;
+static cJSON *yaml_doc;
+static char *bundle_text;
+static HashTable table;
+static char cpuinfo_path[64];
+static uint32_t mem_base;
+static bool mem_hw;
+static volatile uint32_t sink;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// xorshift32, same sequence on every run
+static uint32_t next_rand(uint32_t *s) {
+    *s ^= *s << 13;
+    *s ^= *s >> 17;
+    *s ^= *s << 5;
+    return *s;
+}
+
+static bool setup_buf(void) {
+    if (buf)
+        return true;
+    buf = malloc(BUF_BYTES);
+    if (!buf)
+        return false;
+    uint32_t s = 0x1badb002;
+    for (size_t i = 0; i < BUF_BYTES; i++)
+        buf[i] = next_rand(&s);
+    return true;
+}
+
+static void run_crc32(void) {
+    uint32_t crc = 0;
+    crc32(buf, BUF_BYTES, &crc);
+    sink = crc;
+}
+
+static void run_sha1(void) {
+    char hash[20];
+    SHA1(hash, (const char *)buf, SHA1_BYTES);
+    sink = hash[0];
+}
+
+// Roughly what `ipctool` prints for a NOR camera, partitions repeated
+static bool setup_yaml(void) {
+    yaml_doc = cJSON_CreateObject();
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM("vendor", "HiSilicon");
+    ADD_PARAM("model", "3516EV300");
+    cJSON_AddItemToObject(yaml_doc, "chip", j_inner);
+
+    cJSON *parts = cJSON_CreateArray();
+    for (int i = 0; i < 64; i++) {
+        j_inner = cJSON_CreateObject();
+        ADD_PARAM_FMT("name", "part%d", i);
+        ADD_PARAM_FMT("size", "0x%x", 0x10000 * (i + 1));
+        ADD_PARAM_FMT("sha1", "%08x", 0x9e3779b9U * i);
+        if (i % 4 == 0)
+            ADD_PARAM("path", "/overlay,jffs2,rw");
+        cJSON_AddItemToArray(parts, j_inner);
+    }
+    j_inner = cJSON_CreateObject();
+    ADD_PARAM("type", "nor");
+    ADD_PARAM("block", "64K");
+    cJSON_AddItemToObject(j_inner, "partitions", parts);
+    ADD_PARAM("size", "16M");
+    cJSON *rom = cJSON_CreateArray();
+    cJSON_AddItemToArray(rom, j_inner);
+    cJSON_AddItemToObject(yaml_doc, "rom", rom);
+
+    j_inner = cJSON_CreateObject();
+    ADD_PARAM("vendor", "Sony");
+    ADD_PARAM("model", "IMX335");
+    ADD_PARAM_NUM("bitness", 12);
+    ADD_PARAM_NUM("fps", 30);
+    cJSON *sensors = cJSON_CreateArray();
+    cJSON_AddItemToArray(sensors, j_inner);
+    cJSON_AddItemToObject(yaml_doc, "sensors", sensors);
+    return true;
+}
+
+static void run_yaml(void) {
+    char *out = cYAML_Print(yaml_doc);
+    sink = out ? out[0] : 0;
+    free(out);
+}
+
+// Upgrade bundle header with the keys do_upgrade() looks at
+static bool setup_bundle(void) {
+    cJSON *root = cJSON_CreateObject();
+    cJSON *j_inner = root;
+    ADD_PARAM("mtdPrefix", "hi_sfc:256k(boot),64k(env),2048k(kernel),"
+                           "5120k(rootfs),-(rootfs_data)");
+    cJSON_AddItemToObject(root, "setTotalMem", cJSON_CreateTrue());
+    ADD_PARAM("kernelMem", "32M");
+    ADD_PARAM("osmem", "32M");
+    ADD_PARAM("additionalCmdline", "mtdparts=hi_sfc:256k(boot)");
+    cJSON *parts = cJSON_CreateArray();
+    for (int i = 0; i < 32; i++) {
+        j_inner = cJSON_CreateObject();
+        ADD_PARAM_FMT("name", "part%d", i);
+        ADD_PARAM_NUM("partitionSize", 0x40000 * (i + 1));
+        ADD_PARAM_FMT("file", "https://example.org/fw/part%d.bin", i);
+        ADD_PARAM_NUM("payloadSize", 0x3f000 * (i + 1));
+        ADD_PARAM_FMT("sha1", "%08x%08x%08x%08x%08x", i, 0x9e3779b9U * i,
+                      0x85ebca6bU * i, 0xc2b2ae35U * i, 0x27d4eb2fU * i);
+        cJSON_AddItemToArray(parts, j_inner);
+    }
+    cJSON_AddItemToObject(root, "partitions", parts);
+    bundle_text = cJSON_Print(root);
+    cJSON_Delete(root);
+    return bundle_text;
+}
+
+static void run_bundle(void) {
+    cJSON *json = cJSON_Parse(bundle_text);
+    sink = json != NULL;
+    cJSON_Delete(json);
+}
+
+static bool setup_table(void) {
+    return ht_setup(&table, sizeof(int), sizeof(int), 0) == HT_SUCCESS;
+}
+
+// pid-like keys, the way ptrace.c tracks threads
+static void run_table(void) {
+    for (int i = 0; i < HT_KEYS; i++) {
+        int key = 1000 + i * 7, value = i;
+        ht_insert(&table, &key, &value);
+    }
+    int sum = 0;
+    for (int i = 0; i < HT_KEYS; i++) {
+        int key = 1000 + i * 7;
+        sum += *(int *)ht_lookup(&table, &key);
+    }
+    ht_clear(&table);
+    sink = sum;
+}
+
+static void teardown_table(void) { ht_destroy(&table); }
+
+// Quad-core /proc/cpuinfo, the match is on the last line
+static bool setup_cpuinfo(void) {
+    snprintf(cpuinfo_path, sizeof(cpuinfo_path),
+             "/tmp/ipctool_bench.cpuinfo.%d", (int)getpid());
+    FILE *f = fopen(cpuinfo_path, "w");
+    if (!f)
+        return false;
+    for (int cpu = 0; cpu < 4; cpu++)
+        fprintf(f,
+                "processor\t: %d\n"
+                "model name\t: ARMv7 Processor rev 5 (v7l)\n"
+                "BogoMIPS\t: 1196.03\n"
+                "Features\t: half thumb fastmult vfp edsp neon vfpv3 tls "
+                "vfpv4 idiva idivt vfpd32 lpae evtstrm\n"
+                "CPU implementer\t: 0x41\n"
+                "CPU architecture: 7\n"
+                "CPU variant\t: 0x0\n"
+                "CPU part\t: 0xc07\n"
+                "CPU revision\t: 5\n\n",
+                cpu);
+    fprintf(f, "Hardware\t: Generic DT based system\n"
+               "Revision\t: 0000\n"
+               "Serial\t\t: 0000000000000000\n");
+    fclose(f);
+    return true;
+}
+
+static void run_cpuinfo(void) {
+    char out[64];
+    sink = line_from_file(cpuinfo_path, "Serial.+:.(\\w+)", out, sizeof(out));
+}
+
+static void teardown_cpuinfo(void) { unlink(cpuinfo_path); }
+
+static void run_mem_seq(void) {
+    uint32_t v, sum = 0;
+    for (uint32_t i = 0; i < 256; i++) {
+        mem_reg(mem_base + i * 4, &v, OP_READ);
+        sum += v;
+    }
+    sink = sum;
+}
+
+static void run_mem_hop(void) {
+    uint32_t v, sum = 0;
+    for (uint32_t i = 0; i < 256; i++) {
+        mem_reg(mem_base + (i % 2) * MEM_HOP + i / 2 * 4, &v, OP_READ);
+        sum += v;
+    }
+    sink = sum;
+}
+
+static void teardown_mem(void) {
+    // releases the cached /dev/mem window
+    uint32_t v = 0;
+    mem_reg(0, &v, OP_READ);
+}
+
+static const struct bench_case {
+    const char *name;
+    size_t bytes; // per call, for MB/s
+    unsigned ops; // operations per call, for ns/op
+    bool (*setup)(void);
+    void (*run)(void);
+    void (*teardown)(void);
+} cases[] = {
+    {"crc32_1m", BUF_BYTES, 1, setup_buf, run_crc32, NULL},
+    {"sha1_64k", SHA1_BYTES, 1, setup_buf, run_sha1, NULL},
+    {"cyaml_print", 0, 1, setup_yaml, run_yaml, NULL},
+    {"cjson_parse_bundle", 0, 1, setup_bundle, run_bundle, NULL},
+    {"hashtable_1k", 0, 2 * HT_KEYS, setup_table, run_table, teardown_table},
+    {"line_from_file", 0, 1, setup_cpuinfo, run_cpuinfo, teardown_cpuinfo},
+    {"mem_reg_seq", 0, 256, NULL, run_mem_seq, teardown_mem},
+    {"mem_reg_hop", 0, 256, NULL, run_mem_hop, teardown_mem},
+};
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return x < y ? -1 : x > y;
+}
+
+static double median(double *v, int n) {
+    qsort(v, n, sizeof(*v), cmp_double);
+    return n % 2 ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2;
+}
+
+static double time_batch(void (*run)(void), uint64_t calls) {
+    uint64_t t0 = now_ns();
+    for (uint64_t i = 0; i < calls; i++)
+        run();
+    return now_ns() - t0;
+}
+
+static double round1(double v) { return round(v * 10) / 10; }
+
+static cJSON *run_case(const struct bench_case *c, int reps) {
+    // grow the batch until one takes REP_MIN_NS, that's also the warm-up
+    uint64_t calls = 1;
+    double ns;
+    while ((ns = time_batch(c->run, calls)) < REP_MIN_NS && calls < 1 << 30)
+        calls = ns > 0 ? MAX(calls * 2, calls * REP_MIN_NS / ns) : calls * 2;
+    for (int i = 0; i < WARMUP_REPS; i++)
+        time_batch(c->run, calls);
+
+    double per_call[MAX_REPS], dev[MAX_REPS];
+    for (int i = 0; i < reps; i++)
+        per_call[i] = time_batch(c->run, calls) / calls;
+    double med = median(per_call, reps), min = per_call[0];
+    for (int i = 0; i < reps; i++)
+        dev[i] = fabs(per_call[i] - med);
+    double mad = median(dev, reps);
+
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM("name", c->name);
+    ADD_PARAM_NUM("calls_per_rep", (double)calls);
+    ADD_PARAM_NUM("median_ns", round1(med));
+    ADD_PARAM_NUM("mad_ns", round1(mad));
+    ADD_PARAM_NUM("min_ns", round1(min));
+    if (c->ops > 1)
+        ADD_PARAM_NUM("ns_per_op", round1(med / c->ops));
+    if (c->bytes)
+        ADD_PARAM_NUM("mb_per_sec",
+                      round1(c->bytes / 1.048576e6 / (med / 1e9)));
+    fprintf(stderr, "%-20s %12.1f ns  +- %.1f\n", c->name, med, mad);
+    return j_inner;
+}
+
+static void print_usage(void) {
+    printf("Usage: ipctool_bench [--reps N] [--filter NAME] "
+           "[--mem-base ADDR] [--list]\n"
+           "\n"
+           "  --reps N        timed repetitions per case (default: %d)\n"
+           "  --filter NAME   only cases whose name contains NAME\n"
+           "  --mem-base ADDR time mem_reg() through /dev/mem on ADDR and\n"
+           "                  ADDR + %#x (must be safe to read); the mem_reg\n"
+           "                  cases are skipped without it\n"
+           "  --list          print case names\n",
+           DEFAULT_REPS, MEM_HOP);
+}
+
+int main(int argc, char **argv) {
+    int reps = DEFAULT_REPS;
+    const char *filter = NULL;
+
+    const struct option long_options[] = {
+        {"reps", required_argument, NULL, 'r'},
+        {"filter", required_argument, NULL, 'f'},
+        {"mem-base", required_argument, NULL, 'm'},
+        {"list", no_argument, NULL, 'l'},
+        {"help", no_argument, NULL, 'h'},
+        {NULL, 0, NULL, 0},
+    };
+    int opt;
+    while ((opt = getopt_long(argc, argv, "r:f:m:lh", long_options, NULL)) !=
+           -1) {
+        switch (opt) {
+        case 'r':
+            reps = atoi(optarg);
+            if (reps < 1 || reps > MAX_REPS) {
+                fprintf(stderr, "--reps must be 1..%d\n", MAX_REPS);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'f':
+            filter = optarg;
+            break;
+        case 'm': {
+            char *end;
+            mem_base = strtoul(optarg, &end, 16);
+            if (end == optarg || *end) {
+                fprintf(stderr, "--mem-base: bad address '%s'\n", optarg);
+                return EXIT_FAILURE;
+            }
+            mem_hw = true;
+            break;
+        }
+        case 'l':
+            for (size_t i = 0; i < ARRCNT(cases); i++)
+                puts(cases[i].name);
+            return EXIT_SUCCESS;
+        case 'h':
+            print_usage();
+            return EXIT_SUCCESS;
+        default:
+            print_usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    cJSON *results = cJSON_CreateArray();
+    for (size_t i = 0; i < ARRCNT(cases); i++) {
+        const struct bench_case *c = &cases[i];
+        if (filter && !strstr(c->name, filter))
+            continue;
+        // there is no /dev/mem window to measure without --mem-base
+        if (!mem_hw && (c->run == run_mem_seq || c->run == run_mem_hop)) {
+            fprintf(stderr, "%s: skipped, needs --mem-base\n", c->name);
+            continue;
+        }
+        if (c->setup && !c->setup()) {
+            fprintf(stderr, "%s: setup failed\n", c->name);
+            continue;
+        }
+        cJSON_AddItemToArray(results, run_case(c, reps));
+        if (c->teardown)
+            c->teardown();
+    }
+
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM_NUM("version", BENCH_VERSION);
+    ADD_PARAM_NUM("reps", reps);
+    ADD_PARAM_NUM("warmup_reps", WARMUP_REPS);
+    if (mem_hw)
+        ADD_PARAM_FMT("mem_base", "%#x", mem_base);
+    cJSON_AddItemToObject(j_inner, "cases", results);
+    cJSON *root = cJSON_CreateObject();
+    cJSON_AddItemToObject(root, "ipctool_bench", j_inner);
+    char *out = cJSON_Print(root);
+    if (out) {
+        printf("%s\n", out);
+        free(out);
+    }
+    cJSON_Delete(root);
+    free(buf);
+    cJSON_Delete(yaml_doc);
+    free(bundle_text);
+    return EXIT_SUCCESS;
+}
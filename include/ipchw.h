@@ -1,6 +1,9 @@
 #ifndef IPCHW_H
 #define IPCHW_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
 const char *getchipname();
 const char *getchipfamily();
 const char* getchipvendor();
@@ -8,5 +11,9 @@ const char *getsensoridentity();
 const char *getsensorshort();
 float gethwtemp();
 
+// Resolves a pad or function name (e.g. "GPIO5_6", "UART1_TXD") to its
+// pinmux register address and function number on the detected chip
+bool getpinmux(const char *name, uint32_t *reg, int *func);
+
 
 #endif /* IPCHW_H */
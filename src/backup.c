@@ -33,6 +33,7 @@
 #include "http.h"
 #include "mtd.h"
 #include "network.h"
+#include "profile.h"
 #include "sha1.h"
 #include "tools.h"
 #include "uboot.h"
@@ -564,8 +565,9 @@ static bool ubi_restore_partition(int mtd_num, stored_mtd_t *vols, int nvols,
     return true;
 }
 
-static bool do_flash(const char *phase, stored_mtd_t *mtdbackup,
-                     mtd_restore_ctx_t *mtd, bool skip_env, bool simulate) {
+static bool do_flash_parts(const char *phase, stored_mtd_t *mtdbackup,
+                           mtd_restore_ctx_t *mtd, bool skip_env,
+                           bool simulate) {
     for (int i = 0; i < MAX_MTDBLOCKS; i++) {
         if (!*mtdbackup[i].name)
             continue;
@@ -646,6 +648,15 @@ static bool do_flash(const char *phase, stored_mtd_t *mtdbackup,
     return true;
 }
 
+static bool do_flash(const char *phase, stored_mtd_t *mtdbackup,
+                     mtd_restore_ctx_t *mtd, bool skip_env, bool simulate) {
+    struct prof_scope prof;
+    prof_begin(&prof, "do_flash", phase);
+    bool ret = do_flash_parts(phase, mtdbackup, mtd, skip_env, simulate);
+    prof_end(&prof);
+    return ret;
+}
+
 static bool free_resources(bool force) {
     if (is_xm_board()) {
         if (!xm_kill_stuff(force)) {
@@ -0,0 +1,382 @@
+/* `ipctool bench` -- fixed benchmark suite with baseline comparison.
+ *
+ * Runs the cpubench, membw / latency, flashbench and i2cbench cores plus
+ * SHA-1 and CRC-32 throughput with fixed parameters, so numbers from two
+ * runs (or two firmware builds) of the same SoC are comparable. The
+ * document carries the regular `ipctool` YAML sections as context and a
+ * flat "metrics" object; --baseline compares that object against an
+ * earlier run and exits with 2 if any metric moved past --tolerance in
+ * the bad direction, or if a selected suite failed to produce it.
+ */
+
+#include <getopt.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench.h"
+#include "busbench.h"
+#include "cjson/cJSON.h"
+#include "cpubench.h"
+#include "flashbench.h"
+#include "membw.h"
+#include "memlat.h"
+#include "sha1.h"
+#include "tools.h"
+#include "uboot.h"
+#include "version.h"
+
+// Bump when suite parameters or metric names change
+#define BENCH_VERSION 1
+#define EXIT_REGRESSION 2
+#define DEFAULT_TOLERANCE 10.0
+
+#define CPU_LOOPS 10000000ULL
+#define MEMBW_MB 8
+#define MEMBW_ITERS 4
+#define MEMLAT_MB 16
+#define FLASH_MB 2
+#define BUS_COUNT 1000
+#define BUS_BURST 64
+#define HASH_BYTES (1 << 20)
+#define HASH_MIN_NS 200000000ULL
+
+enum suite {
+    SUITE_CPU = 1 << 0,
+    SUITE_MEM = 1 << 1,
+    SUITE_FLASH = 1 << 2,
+    SUITE_BUS = 1 << 3,
+    SUITE_HASH = 1 << 4,
+    SUITE_ALL = (1 << 5) - 1,
+};
+
+static const struct {
+    const char *name;
+    enum suite bit;
+} suites[] = {
+    {"cpu", SUITE_CPU},   {"mem", SUITE_MEM},   {"flash", SUITE_FLASH},
+    {"bus", SUITE_BUS},   {"hash", SUITE_HASH},
+};
+
+/* Metrics that go into the flat "metrics" object and the comparison.
+ * `path` is a dotted path inside "results" */
+static const struct {
+    const char *name;
+    const char *path;
+    bool lower_is_better;
+    enum suite suite;
+} metrics[] = {
+    {"cpu_mhz", "cpu.consensus_freq_mhz", false, SUITE_CPU},
+    {"mem_write_mb_per_sec", "membw.results.write.mb_per_sec", false,
+     SUITE_MEM},
+    {"mem_read_mb_per_sec", "membw.results.read.mb_per_sec", false,
+     SUITE_MEM},
+    {"mem_copy_mb_per_sec", "membw.results.copy.mb_per_sec", false,
+     SUITE_MEM},
+    {"mem_ddr_latency_ns", "memlat.knees.ddr_ns", true, SUITE_MEM},
+    {"flash_read_mb_per_sec", "flash.reads.read.64k.seq_mb_per_sec", false,
+     SUITE_FLASH},
+    {"bus_reads_per_sec", "bus.read.per_sec", false, SUITE_BUS},
+    {"bus_read_p99_us", "bus.read.p99_us", true, SUITE_BUS},
+    {"sha1_mb_per_sec", "hash.sha1_mb_per_sec", false, SUITE_HASH},
+    {"crc32_mb_per_sec", "hash.crc32_mb_per_sec", false, SUITE_HASH},
+};
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static double round2(double v) { return round(v * 100) / 100; }
+
+static cJSON *hash_build_json(void) {
+    unsigned char *buf = malloc(HASH_BYTES);
+    if (!buf)
+        return NULL;
+    for (size_t i = 0; i < HASH_BYTES; i++)
+        buf[i] = i * 2654435761U >> 24;
+
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM_NUM("buffer_kb", HASH_BYTES / 1024);
+
+    SHA1_CTX sha;
+    unsigned char digest[20];
+    uint64_t n = 0, t0 = now_ns(), dt;
+    SHA1Init(&sha);
+    do {
+        SHA1Update(&sha, buf, HASH_BYTES);
+        n++;
+    } while ((dt = now_ns() - t0) < HASH_MIN_NS);
+    SHA1Final(digest, &sha);
+    ADD_PARAM_NUM("sha1_mb_per_sec", round2(n * HASH_BYTES / 1.048576e6 /
+                                            (dt / 1e9)));
+
+    uint32_t crc = 0;
+    n = 0;
+    t0 = now_ns();
+    do {
+        crc32(buf, HASH_BYTES, &crc);
+        n++;
+    } while ((dt = now_ns() - t0) < HASH_MIN_NS);
+    ADD_PARAM_NUM("crc32_mb_per_sec", round2(n * HASH_BYTES / 1.048576e6 /
+                                             (dt / 1e9)));
+
+    free(buf);
+    return j_inner;
+}
+
+static void add_result(cJSON *results, const char *key, cJSON *json) {
+    cJSON_AddItemToObject(results, key, json ? json : cJSON_CreateNull());
+}
+
+static cJSON *run_suites(unsigned mask) {
+    cJSON *results = cJSON_CreateObject();
+    if (mask & SUITE_CPU) {
+        fprintf(stderr, "bench: cpu\n");
+        add_result(results, "cpu", cpubench_build_json(CPU_LOOPS, -1));
+    }
+    if (mask & SUITE_MEM) {
+        fprintf(stderr, "bench: mem\n");
+        add_result(results, "membw", membw_build_json(MEMBW_MB, MEMBW_ITERS));
+        add_result(results, "memlat", memlat_build_json(MEMLAT_MB, false));
+    }
+    if (mask & SUITE_FLASH) {
+        fprintf(stderr, "bench: flash\n");
+        add_result(results, "flash", flashbench_build_json(FLASH_MB));
+    }
+    if (mask & SUITE_BUS) {
+        fprintf(stderr, "bench: bus\n");
+        add_result(results, "bus", busbench_build_json(BUS_COUNT, BUS_BURST));
+    }
+    if (mask & SUITE_HASH) {
+        fprintf(stderr, "bench: hash\n");
+        add_result(results, "hash", hash_build_json());
+    }
+    return results;
+}
+
+// Walk a dotted path ("a.b.c") of object keys
+static cJSON *get_path(cJSON *obj, const char *path) {
+    char key[64];
+    while (obj && *path) {
+        size_t len = strcspn(path, ".");
+        if (len >= sizeof(key))
+            return NULL;
+        memcpy(key, path, len);
+        key[len] = '\0';
+        obj = cJSON_GetObjectItem(obj, key);
+        path += len + (path[len] == '.');
+    }
+    return obj;
+}
+
+static cJSON *collect_metrics(cJSON *results) {
+    cJSON *j_inner = cJSON_CreateObject();
+    for (size_t i = 0; i < ARRCNT(metrics); i++) {
+        cJSON *v = get_path(results, metrics[i].path);
+        if (cJSON_IsNumber(v))
+            ADD_PARAM_NUM(metrics[i].name, v->valuedouble);
+    }
+    return j_inner;
+}
+
+static cJSON *load_baseline(const char *path) {
+    size_t len;
+    char *buf = file_to_buf(path, &len);
+    if (!buf) {
+        fprintf(stderr, "bench: cannot read baseline %s\n", path);
+        return NULL;
+    }
+    cJSON *json = cJSON_ParseWithLength(buf, len);
+    free(buf);
+    cJSON *bench = cJSON_GetObjectItem(json, "bench");
+    if (!cJSON_IsObject(cJSON_GetObjectItem(bench, "metrics"))) {
+        fprintf(stderr, "bench: %s is not `ipctool bench` output\n", path);
+        cJSON_Delete(json);
+        return NULL;
+    }
+    return json;
+}
+
+/* Comparison array; *regressions counts metrics worse than `tolerance` %
+ * and baseline metrics this run of the `mask` suites failed to produce */
+static cJSON *compare(cJSON *base, cJSON *context, cJSON *cur_metrics,
+                      unsigned mask, double tolerance, int *regressions) {
+    cJSON *bench = cJSON_GetObjectItem(base, "bench");
+    cJSON *version = cJSON_GetObjectItem(bench, "version");
+    if (!cJSON_IsNumber(version) || version->valueint != BENCH_VERSION)
+        fprintf(stderr, "bench: baseline is suite version %d, this is %d\n",
+                cJSON_IsNumber(version) ? version->valueint : 0,
+                BENCH_VERSION);
+    const char *base_chip =
+        cJSON_GetStringValue(get_path(bench, "context.chip.model"));
+    const char *chip = cJSON_GetStringValue(get_path(context, "chip.model"));
+    if (base_chip && chip && strcmp(base_chip, chip))
+        fprintf(stderr, "bench: baseline is from %s, this is %s\n", base_chip,
+                chip);
+
+    cJSON *base_metrics = cJSON_GetObjectItem(bench, "metrics");
+    cJSON *arr = cJSON_CreateArray();
+    *regressions = 0;
+    for (size_t i = 0; i < ARRCNT(metrics); i++) {
+        cJSON *b = cJSON_GetObjectItem(base_metrics, metrics[i].name);
+        cJSON *v = cJSON_GetObjectItem(cur_metrics, metrics[i].name);
+        if (!cJSON_IsNumber(b) || !(mask & metrics[i].suite))
+            continue;
+
+        cJSON *j_inner = cJSON_CreateObject();
+        ADD_PARAM("metric", metrics[i].name);
+        ADD_PARAM_NUM("baseline", b->valuedouble);
+        if (cJSON_IsNumber(v))
+            ADD_PARAM_NUM("value", v->valuedouble);
+        const char *status = "ok";
+        if (!cJSON_IsNumber(v)) {
+            // the suite ran but failed, e.g. no flash or bus access
+            status = "missing";
+            (*regressions)++;
+            fprintf(stderr, "bench: %s is missing from this run\n",
+                    metrics[i].name);
+        } else if (b->valuedouble) {
+            double change =
+                (v->valuedouble - b->valuedouble) / b->valuedouble * 100;
+            ADD_PARAM_NUM("change_pct", round2(change));
+            double worse = metrics[i].lower_is_better ? change : -change;
+            if (worse > tolerance) {
+                status = "regression";
+                (*regressions)++;
+                fprintf(stderr, "bench: %s regressed %.1f%% (%g -> %g)\n",
+                        metrics[i].name, worse, b->valuedouble,
+                        v->valuedouble);
+            } else if (-worse > tolerance)
+                status = "improvement";
+        }
+        ADD_PARAM("status", status);
+        cJSON_AddItemToArray(arr, j_inner);
+    }
+    return arr;
+}
+
+static bool parse_suites(const char *list, unsigned *mask) {
+    *mask = 0;
+    while (*list) {
+        size_t len = strcspn(list, ",");
+        size_t i;
+        for (i = 0; i < ARRCNT(suites); i++)
+            if (strlen(suites[i].name) == len &&
+                !strncmp(suites[i].name, list, len))
+                break;
+        if (i == ARRCNT(suites)) {
+            fprintf(stderr, "bench: unknown suite '%.*s'\n", (int)len, list);
+            return false;
+        }
+        *mask |= suites[i].bit;
+        list += len + (list[len] == ',');
+    }
+    return *mask;
+}
+
+static void print_bench_usage(void) {
+    printf("Usage: ipctool bench [--suite cpu,mem,flash,bus,hash]\n"
+           "                     [--baseline FILE] [--tolerance PCT]\n"
+           "\n"
+           "Run a fixed benchmark suite (CPU clock patterns, DDR bandwidth\n"
+           "and latency, flash read, sensor bus transactions, SHA-1 / CRC-32\n"
+           "throughput) and print one JSON document with chip / sensor /\n"
+           "firmware context. Save it as a baseline for later runs.\n"
+           "\n"
+           "  --suite LIST     comma-separated subset (default: all)\n"
+           "  --baseline FILE  compare against an earlier `ipctool bench`\n"
+           "                   output; exit code %d if any metric is worse\n"
+           "                   than the tolerance or missing from a suite\n"
+           "                   that was run\n"
+           "  --tolerance PCT  allowed change in the bad direction "
+           "(default: %g)\n",
+           EXIT_REGRESSION, DEFAULT_TOLERANCE);
+}
+
+int bench_cmd(int argc, char **argv, cJSON *(*context)(void)) {
+    unsigned mask = SUITE_ALL;
+    const char *baseline_path = NULL;
+    double tolerance = DEFAULT_TOLERANCE;
+
+    const struct option long_options[] = {
+        {"suite", required_argument, NULL, 's'},
+        {"baseline", required_argument, NULL, 'b'},
+        {"tolerance", required_argument, NULL, 't'},
+        {"help", no_argument, NULL, 'h'},
+        {NULL, 0, NULL, 0},
+    };
+    int opt;
+    optind = 1;
+    while ((opt = getopt_long(argc, argv, "s:b:t:h", long_options, NULL)) !=
+           -1) {
+        switch (opt) {
+        case 's':
+            if (!parse_suites(optarg, &mask))
+                return EXIT_FAILURE;
+            break;
+        case 'b':
+            baseline_path = optarg;
+            break;
+        case 't': {
+            char *end;
+            tolerance = strtod(optarg, &end);
+            if (end == optarg || *end || !isfinite(tolerance) ||
+                tolerance < 0) {
+                fprintf(stderr, "bench: --tolerance must be a number >= 0\n");
+                return EXIT_FAILURE;
+            }
+            break;
+        }
+        case 'h':
+            print_bench_usage();
+            return EXIT_SUCCESS;
+        default:
+            print_bench_usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    cJSON *base = NULL;
+    if (baseline_path && !(base = load_baseline(baseline_path)))
+        return EXIT_FAILURE;
+
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM_NUM("version", BENCH_VERSION);
+#ifndef SKIP_VERSION
+    const char *vers = get_git_version();
+    ADD_PARAM("ipctool", *vers ? vers : get_git_revision());
+#endif
+    cJSON *ctx = context();
+    cJSON_AddItemToObject(j_inner, "context",
+                          ctx ? ctx : cJSON_CreateObject());
+    cJSON *results = run_suites(mask);
+    cJSON_AddItemToObject(j_inner, "results", results);
+    cJSON *cur_metrics = collect_metrics(results);
+    cJSON_AddItemToObject(j_inner, "metrics", cur_metrics);
+
+    int regressions = 0;
+    if (base) {
+        cJSON_AddItemToObject(j_inner, "tolerance_pct",
+                              cJSON_CreateNumber(tolerance));
+        cJSON_AddItemToObject(j_inner, "comparison",
+                              compare(base, ctx, cur_metrics, mask, tolerance,
+                                      &regressions));
+        ADD_PARAM_NUM("regressions", regressions);
+        cJSON_Delete(base);
+    }
+
+    cJSON *root = cJSON_CreateObject();
+    cJSON_AddItemToObject(root, "bench", j_inner);
+    char *out = cJSON_Print(root);
+    if (out) {
+        printf("%s\n", out);
+        free(out);
+    }
+    cJSON_Delete(root);
+    return regressions ? EXIT_REGRESSION : EXIT_SUCCESS;
+}
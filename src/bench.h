@@ -0,0 +1,10 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "cjson/cJSON.h"
+
+/* `context` builds the chip / board / sensor sections embedded in the
+ * report (main.c's build_yaml) */
+int bench_cmd(int argc, char **argv, cJSON *(*context)(void));
+
+#endif /* BENCH_H */
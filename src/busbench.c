@@ -0,0 +1,467 @@
+/* `ipctool i2cbench` / `ipctool spibench` -- sensor control bus benchmark.
+ *
+ * Detects the sensor the same way the main report does and then hammers
+ * one of its chip ID registers through whichever register access layer
+ * the HAL installed (hisi_gen1 /dev/hi_i2c ioctls, hisi_gen2 read/write,
+ * I2C_RDWR on a stock /dev/i2c-N, XM's driver, spidev, ...), so the cost
+ * of a sensor register access can be compared between HALs and kernels:
+ *
+ *   - single-register reads: transactions per second and per-call
+ *     latency percentiles
+ *   - single-register writes of the value just read back, only to ID
+ *     registers documented as read-only (the sensor acknowledges and
+ *     drops them, nothing gets reconfigured)
+ *   - bursts: one combined I2C_RDWR transfer reading --burst bytes
+ *     starting at the ID register with the sensor's address
+ *     auto-increment; only where the fd is a stock i2c-dev
+ *
+ * The configured bus clock comes from the adapter's device tree
+ * clock-frequency (or the spidev max speed) and, for an i2c-hibvt
+ * controller (Hisilicon V4 / V4A), from the SCL high/low counts the
+ * driver programmed into it, at the base the device tree gives.
+ */
+
+#include <getopt.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "busbench.h"
+#include "chipid.h"
+#include "cjson/cJSON.h"
+#include "cjson/cYAML.h"
+#include "hal/common.h"
+#include "profile.h"
+#include "sensors.h"
+#include "tools.h"
+
+#define DEFAULT_COUNT 1000
+#define DEFAULT_BURST 64
+#define MAX_BURST 256
+
+#define SPI_IOC_RD_MAX_SPEED_HZ _IOR(SPI_IOC_MAGIC, 4, __u32)
+
+// hibvt I2C controller (Hisilicon V4 / V4A), 50 MHz functional clock
+#define HIBVT_I2C_SCL_H 0x4
+#define HIBVT_I2C_SCL_L 0x8
+#define HIBVT_I2C_CLK 50000000
+
+struct id_reg {
+    const char *vendor;
+    uint16_t reg16; // sensors addressed with 16-bit registers
+    uint8_t reg8;   // sensors addressed with 8-bit registers
+    bool ro;        // documented read-only: safe target for writes
+};
+
+static const struct id_reg id_regs[] = {
+    {"Silicon Optronics", 0, 0x0a, true},
+    {"ON Semiconductor", 0x3000, 0, true},
+    {"OmniVision", 0x300a, 0x0a, true},
+    {"SmartSens", 0x3107, 0, true},
+    {"GalaxyCore", 0x03f0, 0xf0, true},
+    // product ID lives in a banked page, don't disturb 0xFD
+    {"SuperPix", 0, 0x02, false},
+    {"TechPoint", 0, 0xfe, true},
+    {"ImageDesign", 0x3000, 0, true},
+    {"ViSemi", 0x3000, 0, true},
+    {"CVSENS", 0x3003, 0, true},
+    // no chip ID register, 0x3057 is Y_OUT_SIZE MSB (host-writable)
+    {"Sony", 0x3057, 0, false},
+};
+
+static const struct {
+    read_register_t fn;
+    const char *name;
+    bool i2c_dev; // fd is a stock i2c-dev, I2C_RDWR is available
+} hals[] = {
+    {universal_i2c_read_register, "universal_i2c", true},
+    {universal_spi_read_register, "universal_spi", false},
+    {hisi_gen1_sensor_read_register, "hisi_gen1", false},
+    {sony_ssp_read_register, "hisi_gen1_ssp", false},
+    {hisi_gen2_sensor_read_register, "hisi_gen2", false},
+    {hisi_sensor_read_register, "hisi_i2c", true},
+    {xm_sensor_read_register, "xm_sensor", false},
+};
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static int cmp_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+struct run {
+    uint32_t *ns; // per-call latency, sorted by add_run()
+    unsigned n, errors;
+    uint64_t total_ns;
+};
+
+static double us(uint32_t ns) { return round(ns / 100.0) / 10; }
+
+static void add_run(cJSON *j_root, const char *what, struct run *r,
+                    size_t bytes) {
+    if (!r->n)
+        return;
+    qsort(r->ns, r->n, sizeof(*r->ns), cmp_u32);
+
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM_NUM("count", r->n);
+    if (r->errors)
+        ADD_PARAM_NUM("errors", r->errors);
+    double secs = r->total_ns / 1e9;
+    ADD_PARAM_NUM("per_sec", round(r->n / secs));
+    if (bytes) {
+        ADD_PARAM_NUM("bytes", bytes);
+        ADD_PARAM_NUM("kb_per_sec", round(r->n * bytes / 102.4 / secs) / 10);
+    }
+    ADD_PARAM_NUM("p50_us", us(r->ns[r->n / 2]));
+    ADD_PARAM_NUM("p95_us", us(r->ns[r->n * 95 / 100]));
+    ADD_PARAM_NUM("p99_us", us(r->ns[r->n * 99 / 100]));
+    ADD_PARAM_NUM("max_us", us(r->ns[r->n - 1]));
+    cJSON_AddItemToObject(j_root, what, j_inner);
+
+    fprintf(stderr, "%-6s %7.0f/s  p50 %7.1f us  p99 %7.1f us", what,
+            r->n / secs, us(r->ns[r->n / 2]), us(r->ns[r->n * 99 / 100]));
+    if (bytes)
+        fprintf(stderr, "  %.1f KB/s", r->n * bytes / 1024.0 / secs);
+    if (r->errors)
+        fprintf(stderr, "  (%u errors)", r->errors);
+    fputc('\n', stderr);
+}
+
+static bool burst_read(int fd, unsigned char i2c_addr, unsigned int reg_addr,
+                       unsigned int reg_width, unsigned char *buf,
+                       size_t len) {
+    unsigned char reg[2];
+    if (reg_width == 2) {
+        reg[0] = (reg_addr >> 8) & 0xff;
+        reg[1] = reg_addr & 0xff;
+    } else
+        reg[0] = reg_addr & 0xff;
+
+    struct i2c_msg msg[2] = {
+        {.addr = i2c_addr >> 1, .flags = 0, .len = reg_width, .buf = reg},
+        {.addr = i2c_addr >> 1, .flags = I2C_M_RD, .len = len, .buf = buf},
+    };
+    struct i2c_rdwr_ioctl_data rdwr = {.msgs = msg, .nmsgs = 2};
+    return ioctl(fd, I2C_RDWR, &rdwr) == 2;
+}
+
+enum op { OP_READ_REG, OP_WRITE_REG, OP_BURST };
+
+struct target {
+    int fd;
+    sensor_ctx_t *ctx;
+    unsigned int reg;
+    int value; // what the ID register reads back, written unchanged
+    read_register_t read_register;
+    write_register_t write_register;
+    unsigned char buf[MAX_BURST];
+    size_t burst;
+};
+
+static bool do_op(struct target *t, enum op op) {
+    sensor_ctx_t *ctx = t->ctx;
+    switch (op) {
+    case OP_READ_REG:
+        return t->read_register(t->fd, ctx->addr, t->reg, ctx->reg_width,
+                                ctx->data_width) >= 0;
+    case OP_WRITE_REG:
+        return t->write_register(t->fd, ctx->addr, t->reg, ctx->reg_width,
+                                 t->value, ctx->data_width) >= 0;
+    case OP_BURST:
+        return burst_read(t->fd, ctx->addr, t->reg, ctx->reg_width, t->buf,
+                          t->burst);
+    }
+    return false;
+}
+
+static void time_op(struct target *t, enum op op, struct run *r,
+                    unsigned count) {
+    r->n = r->errors = 0;
+    r->total_ns = 0;
+    for (unsigned i = 0; i < count; i++) {
+        uint64_t start = now_ns();
+        if (!do_op(t, op))
+            r->errors++;
+        uint32_t ns = now_ns() - start;
+        r->ns[r->n++] = ns;
+        r->total_ns += ns;
+    }
+}
+
+// raw property of the adapter's device tree node, bytes read
+static size_t dt_i2c_prop(int nr, const char *prop, void *buf, size_t len) {
+    char path[80];
+    snprintf(path, sizeof(path), "/sys/class/i2c-adapter/i2c-%d/of_node/%s",
+             nr, prop);
+    FILE *f = fopen(path, "rb");
+    if (!f)
+        return 0;
+    size_t n = fread(buf, 1, len, f);
+    fclose(f);
+    return n;
+}
+
+static uint32_t be32(const unsigned char *be) {
+    return (uint32_t)be[0] << 24 | be[1] << 16 | be[2] << 8 | be[3];
+}
+
+// clock-frequency property of the adapter's device tree node
+static uint32_t dt_i2c_hz(int nr) {
+    unsigned char be[4];
+    if (dt_i2c_prop(nr, "clock-frequency", be, sizeof(be)) != sizeof(be))
+        return 0;
+    return be32(be);
+}
+
+/* Controller base from the node's reg property, when the node is an
+ * i2c-hibvt one: <addr size> with one or two cells each */
+static uint32_t dt_hibvt_base(int nr) {
+    char compat[128];
+    size_t n = dt_i2c_prop(nr, "compatible", compat, sizeof(compat) - 1);
+    compat[n] = '\0';
+    bool hibvt = false;
+    // a list of nul-terminated strings
+    for (size_t i = 0; i < n; i += strlen(compat + i) + 1)
+        if (strstr(compat + i, "hibvt-i2c"))
+            hibvt = true;
+    if (!hibvt)
+        return 0;
+
+    unsigned char reg[16];
+    n = dt_i2c_prop(nr, "reg", reg, sizeof(reg));
+    if (n == 8)
+        return be32(reg);
+    // 64-bit address, only the low half fits /dev/mem access here
+    if (n == 16 && !be32(reg))
+        return be32(reg + 4);
+    return 0;
+}
+
+/* i2c-hibvt programs SCL_H / SCL_L so that
+ * clk / ((SCL_H + 1) + (SCL_L + 1)) is the requested bus frequency. The
+ * controller is found through the device tree; without one only the
+ * V4 layout of one 4 KiB window per adapter is assumed. */
+static uint32_t hibvt_i2c_hz(int nr) {
+    uint32_t base = dt_hibvt_base(nr);
+    if (!base && chip_generation == HISI_V4 && nr >= 0 && nr <= 7)
+        base = 0x12060000 + nr * 0x1000;
+    if (!base)
+        return 0;
+
+    uint32_t h = 0, l = 0;
+    if (!mem_reg(base + HIBVT_I2C_SCL_H, &h, OP_READ) ||
+        !mem_reg(base + HIBVT_I2C_SCL_L, &l, OP_READ))
+        return 0;
+    h &= 0xffff;
+    l &= 0xffff;
+    if (!h || !l)
+        return 0;
+    return HIBVT_I2C_CLK / (h + l + 2);
+}
+
+static void add_bus_clock(cJSON *j_inner, bool spi, int fd) {
+    if (spi) {
+        uint32_t hz = 0;
+        if (ioctl(fd, SPI_IOC_RD_MAX_SPEED_HZ, &hz) == 0 && hz)
+            ADD_PARAM_NUM("spidev_hz", hz);
+        return;
+    }
+    uint32_t dt = dt_i2c_hz(i2c_adapter_nr);
+    if (dt)
+        ADD_PARAM_NUM("dt_clock_hz", dt);
+    uint32_t ctl = hibvt_i2c_hz(i2c_adapter_nr);
+    if (ctl)
+        ADD_PARAM_NUM("controller_hz", ctl);
+}
+
+// want_spi: 0 / 1 to insist on the I2C / SPI sensor, -1 for either
+static cJSON *build_json(unsigned count, unsigned burst, int want_spi) {
+    sensor_ctx_t ctx;
+    memset(&ctx, 0, sizeof(ctx));
+    if (!getsensorid(&ctx)) {
+        fprintf(stderr, "No sensor detected\n");
+        return NULL;
+    }
+    bool spi = !strcmp(ctx.control, "spi");
+    if (want_spi >= 0 && spi != want_spi) {
+        fprintf(stderr, "%s %s is on %s, use %sbench\n", ctx.vendor,
+                ctx.sensor_id, ctx.control, ctx.control);
+        return NULL;
+    }
+
+    const struct id_reg *id = NULL;
+    for (size_t i = 0; i < ARRCNT(id_regs); i++)
+        if (!strcmp(id_regs[i].vendor, ctx.vendor))
+            id = &id_regs[i];
+    unsigned int reg = 0;
+    if (id)
+        reg = ctx.reg_width == 1 ? id->reg8 : id->reg16;
+    if (!reg) {
+        fprintf(stderr, "No ID register known for %s %s\n", ctx.vendor,
+                ctx.sensor_id);
+        return NULL;
+    }
+
+    struct target t = {
+        .ctx = &ctx,
+        .reg = reg,
+        .read_register = spi ? spi_read_register : i2c_read_register,
+        .write_register = spi ? spi_write_register : i2c_write_register,
+        .burst = burst,
+    };
+    const char *hal = "platform";
+    bool i2c_dev = false;
+    for (size_t i = 0; i < ARRCNT(hals); i++)
+        if (hals[i].fn == prof_hal_read(t.read_register)) {
+            hal = hals[i].name;
+            i2c_dev = hals[i].i2c_dev;
+        }
+
+    t.fd = spi ? (open_spi_sensor_fd ? open_spi_sensor_fd() : -1)
+               : open_i2c_sensor_fd(i2c_adapter_nr);
+    if (t.fd < 0) {
+        fprintf(stderr, "Cannot open %s device\n", ctx.control);
+        return NULL;
+    }
+    if (!spi)
+        i2c_change_addr(t.fd, ctx.addr);
+
+    struct run r = {.ns = calloc(count, sizeof(uint32_t))};
+    t.value = t.read_register(t.fd, ctx.addr, reg, ctx.reg_width,
+                              ctx.data_width);
+    if (t.value < 0 || !r.ns) {
+        fprintf(stderr, "Cannot read register 0x%x\n", reg);
+        free(r.ns);
+        close_sensor_fd(t.fd);
+        hal_cleanup();
+        return NULL;
+    }
+
+    cJSON *j_root = cJSON_CreateObject();
+    cJSON *j_inner = j_root;
+    ADD_PARAM("sensor", ctx.sensor_id);
+    ADD_PARAM("vendor", ctx.vendor);
+    ADD_PARAM("control", ctx.control);
+    if (!spi) {
+        ADD_PARAM_FMT("bus", "i2c-%d", i2c_adapter_nr);
+        ADD_PARAM_FMT("addr", "0x%x", ctx.addr);
+    }
+    ADD_PARAM("hal", hal);
+    ADD_PARAM_FMT("register", "0x%x", reg);
+    ADD_PARAM_NUM("reg_width", ctx.reg_width);
+    ADD_PARAM_NUM("data_width", ctx.data_width);
+    add_bus_clock(j_root, spi, t.fd);
+    fprintf(stderr, "%s %s via %s, register 0x%x\n", ctx.vendor,
+            ctx.sensor_id, hal, reg);
+
+    time_op(&t, OP_READ_REG, &r, count);
+    add_run(j_root, "read", &r, 0);
+
+    if (!id->ro)
+        ADD_PARAM("write", "skipped, no read-only ID register");
+    else if (!t.write_register)
+        ADD_PARAM("write", "no HAL write access");
+    else {
+        time_op(&t, OP_WRITE_REG, &r, count);
+        add_run(j_root, "write", &r, 0);
+    }
+
+    if (burst && !spi) {
+        if (i2c_dev && do_op(&t, OP_BURST)) {
+            time_op(&t, OP_BURST, &r, count);
+            add_run(j_root, "burst", &r, burst);
+        } else
+            ADD_PARAM("burst", "no I2C_RDWR on this HAL");
+    }
+    free(r.ns);
+    close_sensor_fd(t.fd);
+    hal_cleanup();
+    return j_root;
+}
+
+cJSON *busbench_build_json(unsigned count, unsigned burst) {
+    return build_json(count, burst, -1);
+}
+
+static void print_busbench_usage(const char *cmd) {
+    printf("Usage: ipctool %s [--count N] [--burst BYTES] [--json]\n"
+           "\n"
+           "Time single-register reads, writes and burst reads of the\n"
+           "detected sensor's chip ID registers through the platform HAL\n"
+           "and report rates, latency percentiles and the bus clock.\n"
+           "Writes go only to registers documented as read-only.\n"
+           "\n"
+           "  --count N      transactions per test (default: %d)\n"
+           "  --burst BYTES  I2C burst read length (default: %d, 0 "
+           "disables)\n"
+           "  --json         machine-readable JSON instead of YAML\n",
+           cmd, DEFAULT_COUNT, DEFAULT_BURST);
+}
+
+int busbench_cmd(int argc, char **argv) {
+    unsigned count = DEFAULT_COUNT, burst = DEFAULT_BURST;
+    bool want_json = false;
+    bool spi = argv[0][0] == 's';
+
+    const struct option long_options[] = {
+        {"count", required_argument, NULL, 'n'},
+        {"burst", required_argument, NULL, 'b'},
+        {"json", no_argument, NULL, 'j'},
+        {"help", no_argument, NULL, 'h'},
+        {NULL, 0, NULL, 0},
+    };
+    int opt;
+    optind = 1;
+    while ((opt = getopt_long(argc, argv, "n:b:jh", long_options, NULL)) !=
+           -1) {
+        switch (opt) {
+        case 'n':
+            count = strtoul(optarg, NULL, 10);
+            break;
+        case 'b':
+            burst = strtoul(optarg, NULL, 10);
+            break;
+        case 'j':
+            want_json = true;
+            break;
+        case 'h':
+            print_busbench_usage(argv[0]);
+            return EXIT_SUCCESS;
+        default:
+            print_busbench_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (!count || count > 1000000 || burst > MAX_BURST) {
+        fprintf(stderr, "%s: need 1 <= --count <= 1000000, --burst <= %d\n",
+                argv[0], MAX_BURST);
+        return EXIT_FAILURE;
+    }
+
+    cJSON *j_root = build_json(count, burst, spi);
+    if (!j_root)
+        return EXIT_FAILURE;
+
+    cJSON *root = cJSON_CreateObject();
+    cJSON_AddItemToObject(root, spi ? "spibench" : "i2cbench", j_root);
+    char *out = want_json ? cJSON_Print(root) : cYAML_Print(root);
+    if (out) {
+        printf("%s", out);
+        if (want_json)
+            printf("\n");
+        free(out);
+    }
+    cJSON_Delete(root);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,12 @@
+#ifndef BUSBENCH_H
+#define BUSBENCH_H
+
+#include "cjson/cJSON.h"
+
+int busbench_cmd(int argc, char **argv);
+
+/* Read / write / burst timings against the detected sensor (I2C or SPI),
+ * as printed by `ipctool i2cbench`. NULL without a usable sensor. */
+cJSON *busbench_build_json(unsigned count, unsigned burst);
+
+#endif /* BUSBENCH_H */
@@ -12,6 +12,8 @@
 
 #include "chipid.h"
 #include "hal/common.h"
+#include "profile.h"
+#include "sim.h"
 #include "tools.h"
 
 int chip_generation;
@@ -154,6 +156,8 @@ const char *getchipname() {
     setup_hal_fallback();
     if (!hw_detect_system())
         return NULL;
+    sim_wrap_hal();
+    prof_wrap_hal();
 
     if (!strcmp(chip_manufacturer, VENDOR_HISI))
         strcpy(sysid, "hi");
@@ -305,6 +305,45 @@ cJSON *clocks_build_json(bool brief) {
     return j_inner;
 }
 
+bool clocks_reg_name(uint32_t reg, char *buf, size_t len) {
+    if (!getchipname())
+        return false;
+
+    const struct clock_family *fam = family_for_chip(chip_generation);
+    if (!fam)
+        return false;
+
+    for (size_t i = 0; i < fam->n_plls; i++) {
+        const struct pll_info *p = &fam->plls[i];
+        const char *field = NULL;
+        if (reg == p->ctrl_reg1)
+            field = "ctrl_reg1";
+        else if (p->ctrl_reg2 && reg == p->ctrl_reg2)
+            field = "ctrl_reg2";
+        else if (p->lock_reg && reg == p->lock_reg)
+            field = "lock_reg";
+        if (field) {
+            snprintf(buf, len, "%s.%s", p->name, field);
+            return true;
+        }
+    }
+    for (size_t i = 0; i < fam->n_muxes; i++) {
+        if (fam->muxes[i].reg == reg) {
+            snprintf(buf, len, "%s", fam->muxes[i].name);
+            return true;
+        }
+    }
+    for (size_t i = 0; i < fam->n_hpms; i++) {
+        const struct hpm_info *h = &fam->hpms[i];
+        if (h->reg == reg || (h->aux_reg && h->aux_reg == reg)) {
+            snprintf(buf, len, "%s.%s", h->name,
+                     h->reg == reg ? "reg" : h->aux_name ? h->aux_name : "aux");
+            return true;
+        }
+    }
+    return false;
+}
+
 static void print_clocks_usage(const char *prog) {
     printf("Usage: %s clocks [--json]\n"
            "       %s freq   [--json]\n"
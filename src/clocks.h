@@ -92,6 +92,10 @@ struct clock_family {
  *                   HPM aux register, etc.) -- used by `ipctool clocks`. */
 cJSON *clocks_build_json(bool brief);
 
+/* Names a register that belongs to the current chip's clock tables, e.g.
+ * "cpu_pll.ctrl_reg1" or "ddr". Returns false if it isn't known. */
+bool clocks_reg_name(uint32_t reg, char *buf, size_t len);
+
 int clocks_cmd(int argc, char **argv);
 
 #endif /* CLOCKS_H */
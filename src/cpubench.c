@@ -20,28 +20,97 @@
  *     f_dep_mul  = ops_per_sec * (16*3 + 3) / 16        = ops_per_sec * 3.1875
  *
  * Three independent timing models should converge to within ~2% on a
- * Cortex-A7. Build is ARM-gated; on x86/etc. the subcommand reports
- * "not supported".
+ * Cortex-A7. Other cores get their own cycle model (cpu_models[]), picked
+ * per core from the "CPU part" (ARM) or "cpu model" (MIPS) line of
+ * /proc/cpuinfo, so big.LITTLE parts are decoded correctly. The patterns
+ * exist for 32-bit ARM, aarch64 and MIPS32; on x86/etc. the subcommand
+ * reports "not supported".
+ *
+ * Every online core is measured in turn with the thread pinned to it, and
+ * the kernel's cpufreq view of that core is reported next to the implied
+ * clock: a core that comes out well below its siblings (or below
+ * cpufreq) is throttled, parked by DVFS or mis-clocked.
  */
 
+#define _GNU_SOURCE
+
 #include <getopt.h>
+#include <pthread.h>
+#include <sched.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <unistd.h>
 
 #include "cjson/cJSON.h"
 #include "cjson/cYAML.h"
 #include "cpubench.h"
 #include "tools.h"
 
-#ifdef __arm__
+#if defined(__arm__) || defined(__aarch64__) ||                                \
+    (defined(__mips__) && !defined(__mips64))
 
 /* Replicate a string 16 times so the inner asm block has 16 ops, making
  * outer-loop overhead negligible. */
 #define REP16(X) X X X X X X X X X X X X X X X X
 
+#if defined(__arm__)
+#define ASM_ADD(r) "add %" r ", %" r ", #1\n\t"
+#define ASM_MUL(r) "mul %" r ", %" r ", %" r "\n\t"
+#elif defined(__aarch64__)
+/* W registers: 64-bit MUL has one cycle more latency on A53/A55 */
+#define ASM_ADD(r) "add %w" r ", %w" r ", #1\n\t"
+#define ASM_MUL(r) "mul %w" r ", %w" r ", %w" r "\n\t"
+#else
+#define ASM_ADD(r) "addiu %" r ", %" r ", 1\n\t"
+#define ASM_MUL(r) "mul %" r ", %" r ", %" r "\n\t"
+#if __mips_isa_rev < 6
+/* pre-R6 `mul` also leaves the product in HI / LO */
+#define ASM_MUL_CLOBBERS "hi", "lo"
+#endif
+#endif
+
+#define LOOP_OVERHEAD 3.0 /* cycles per outer iteration */
+#define MAX_CPUS 64
+
+/* Cycles per op for each pattern. Sources: Arm TRMs / optimization
+ * guides; the MIPS entries are from Ingenic programming manuals and
+ * measurements against the PLL setting. */
+struct cpu_model {
+    const char *name;
+    const char *match; /* "CPU part" (ARM) or part of "cpu model" (MIPS) */
+    double dep_add;
+    double indep_add;
+    double dep_mul;
+};
+
+static const struct cpu_model cpu_models[] = {
+#if defined(__arm__) || defined(__aarch64__)
+    {"ARM926EJ-S", "0x926", 1.0, 1.0, 3.0},
+    {"ARM1176JZF-S", "0xb76", 1.0, 1.0, 3.0},
+    {"Cortex-A5", "0xc05", 1.0, 1.0, 3.0},
+    {"Cortex-A7", "0xc07", 1.0, 0.5, 3.0},
+    {"Cortex-A9", "0xc09", 1.0, 0.5, 3.0},
+    {"Cortex-A17", "0xc0e", 1.0, 0.5, 3.0},
+    {"Cortex-A53", "0xd03", 1.0, 0.5, 3.0},
+    {"Cortex-A35", "0xd04", 1.0, 0.5, 3.0},
+    {"Cortex-A55", "0xd05", 1.0, 0.5, 3.0},
+    {"Cortex-A72", "0xd08", 1.0, 0.5, 3.0},
+    {"Cortex-A73", "0xd09", 1.0, 0.5, 3.0},
+#else
+    {"XBurst2", "XBurst\xc2\xae" "2", 1.0, 0.5, 3.0},
+    {"XBurst2", "Xburst2", 1.0, 0.5, 3.0},
+    {"XBurst", "Xburst", 1.0, 1.0, 2.0},
+#endif
+};
+
+/* Used when the core isn't in cpu_models[]: scalar ALU latency is one
+ * cycle nearly everywhere, so dep_add stays meaningful and the spread
+ * shows how far off the other two guesses are. */
+static const struct cpu_model generic_model = {"unknown", NULL, 1.0, 0.5, 3.0};
+
 static volatile uint32_t sink_u;
 
 static double bench_dep_add(uint64_t loops) {
@@ -49,7 +118,7 @@ static double bench_dep_add(uint64_t loops) {
     clock_gettime(CLOCK_MONOTONIC, &t0);
     uint32_t r0 = 0;
     for (uint64_t i = 0; i < loops; i++) {
-        __asm__ __volatile__(REP16("add %0, %0, #1\n\t") : "+r"(r0));
+        __asm__ __volatile__(REP16(ASM_ADD("0")) : "+r"(r0));
     }
     clock_gettime(CLOCK_MONOTONIC, &t1);
     sink_u = r0;
@@ -62,8 +131,7 @@ static double bench_indep_add(uint64_t loops) {
     clock_gettime(CLOCK_MONOTONIC, &t0);
     uint32_t r0 = 0, r1 = 0;
     for (uint64_t i = 0; i < loops; i++) {
-        __asm__ __volatile__(REP16("add %0, %0, #1\n\t"
-                                   "add %1, %1, #1\n\t")
+        __asm__ __volatile__(REP16(ASM_ADD("0") ASM_ADD("1"))
                              : "+r"(r0), "+r"(r1));
     }
     clock_gettime(CLOCK_MONOTONIC, &t1);
@@ -77,7 +145,14 @@ static double bench_dep_mul(uint64_t loops) {
     clock_gettime(CLOCK_MONOTONIC, &t0);
     uint32_t r0 = 3;
     for (uint64_t i = 0; i < loops; i++) {
-        __asm__ __volatile__(REP16("mul %0, %0, %0\n\t") : "+r"(r0));
+#ifdef ASM_MUL_CLOBBERS
+        __asm__ __volatile__(REP16(ASM_MUL("0"))
+                             : "+r"(r0)
+                             :
+                             : ASM_MUL_CLOBBERS);
+#else
+        __asm__ __volatile__(REP16(ASM_MUL("0")) : "+r"(r0));
+#endif
     }
     clock_gettime(CLOCK_MONOTONIC, &t1);
     sink_u = r0;
@@ -91,7 +166,7 @@ struct pattern_result {
     double ops_per_sec;
     double freq_mhz;
     double cycles_per_op; /* assumed model */
-    const char *model_note;
+    char model_note[48];
 };
 
 static cJSON *result_to_json(const struct pattern_result *r) {
@@ -99,48 +174,120 @@ static cJSON *result_to_json(const struct pattern_result *r) {
     ADD_PARAM_NUM("ops_per_sec_M", r->ops_per_sec / 1e6);
     ADD_PARAM_NUM("cycles_per_op", r->cycles_per_op);
     ADD_PARAM_NUM("freq_mhz", r->freq_mhz);
-    if (r->model_note)
-        ADD_PARAM("model", r->model_note);
+    ADD_PARAM("model", r->model_note);
     return j_inner;
 }
 
-static cJSON *build_cpubench_json(uint64_t loops) {
+/* Fills model[cpu] from /proc/cpuinfo. Old ARM kernels print "CPU part"
+ * once after all "processor" entries; it then applies to every core. */
+static void detect_models(const struct cpu_model **model, int ncpus) {
+    for (int i = 0; i < ncpus; i++)
+        model[i] = NULL;
+
+    const struct cpu_model *last = NULL;
+    int cur = -1;
+    char line[256];
+    FILE *f = fopen("/proc/cpuinfo", "r");
+    while (f && fgets(line, sizeof(line), f)) {
+        int n;
+        if (sscanf(line, "processor : %d", &n) == 1) {
+            cur = n;
+            continue;
+        }
+        char *val = strchr(line, ':');
+        if (!val || (strncmp(line, "CPU part", 8) &&
+                     strncmp(line, "cpu model", 9)))
+            continue;
+        for (size_t i = 0; i < ARRCNT(cpu_models); i++) {
+            if (!strstr(val, cpu_models[i].match))
+                continue;
+            last = &cpu_models[i];
+            if (cur >= 0 && cur < ncpus && !model[cur])
+                model[cur] = last;
+            break;
+        }
+    }
+    if (f)
+        fclose(f);
+
+    for (int i = 0; i < ncpus; i++)
+        if (!model[i])
+            model[i] = last ? last : &generic_model;
+}
+
+static double cpufreq_mhz(int cpu) {
+    char path[80];
+    snprintf(path, sizeof(path),
+             "/sys/devices/system/cpu/cpu%d/cpufreq/scaling_cur_freq", cpu);
+    FILE *f = fopen(path, "r");
+    if (!f)
+        return 0;
+    unsigned long khz = 0;
+    if (fscanf(f, "%lu", &khz) != 1)
+        khz = 0;
+    fclose(f);
+    return khz / 1000.0;
+}
+
+static const struct cpu_model *cached_models[MAX_CPUS];
+static int cached_ncpus;
+
+static void init_cached_models(void) {
+    cached_ncpus = MIN(MAX(sysconf(_SC_NPROCESSORS_CONF), 1L), (long)MAX_CPUS);
+    detect_models(cached_models, cached_ncpus);
+}
+
+double cpubench_dep_add_mhz(uint64_t loops) {
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+    pthread_once(&once, init_cached_models);
+
+    int cpu = sched_getcpu();
+    const struct cpu_model *m =
+        cpu >= 0 && cpu < cached_ncpus ? cached_models[cpu] : &generic_model;
+
+    /* Thread CPU time rather than wall time: the caller runs for minutes
+     * next to the streamer, and time sliced away isn't a slower clock */
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t0);
+    bench_dep_add(loops);
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t1);
+    double dt = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) / 1e9;
+    if (dt <= 0)
+        return 0;
+    return loops * (16 * m->dep_add + LOOP_OVERHEAD) / dt / 1e6;
+}
+
+static void set_result(struct pattern_result *r, const char *name,
+                       const char *label, double ops_per_sec,
+                       double ops_per_block, double cyc,
+                       const struct cpu_model *m, const char *what) {
+    r->name = name;
+    r->label = label;
+    r->ops_per_sec = ops_per_sec;
+    /* per-op cost plus the outer-loop overhead spread over the block */
+    r->cycles_per_op = (ops_per_block * cyc + LOOP_OVERHEAD) / ops_per_block;
+    r->freq_mhz = r->ops_per_sec * r->cycles_per_op / 1e6;
+    snprintf(r->model_note, sizeof(r->model_note), "%s: %g cyc/op %s",
+             m->name, cyc, what);
+}
+
+static cJSON *bench_core(uint64_t loops, const struct cpu_model *m,
+                         double *consensus) {
     /* Three timing models, with the 16-ops-per-block + 3-cyc outer overhead
      * accounted for in the implied-clock calculation. */
     struct pattern_result results[3];
-    results[0].name = "dep_add";
-    results[0].label = "Dependent integer ADD";
-    results[0].ops_per_sec = bench_dep_add(loops);
-    results[0].cycles_per_op = 19.0 / 16.0; /* 1 cyc/op + 3 cyc loop overhead */
-    results[0].freq_mhz =
-        results[0].ops_per_sec * results[0].cycles_per_op / 1e6;
-    results[0].model_note = "A7: 1 cyc/op dep ALU";
-
-    results[1].name = "indep_add";
-    results[1].label = "Independent integer ADD pair (dual-issue)";
-    results[1].ops_per_sec = bench_indep_add(loops);
-    results[1].cycles_per_op = 19.0 / 32.0; /* 16 cyc for 32 ops + 3 ovh */
-    results[1].freq_mhz =
-        results[1].ops_per_sec * results[1].cycles_per_op / 1e6;
-    results[1].model_note = "A7: 0.5 cyc/op dual-issue ALU";
-
-    results[2].name = "dep_mul";
-    results[2].label = "Dependent integer MUL";
-    results[2].ops_per_sec = bench_dep_mul(loops);
-    results[2].cycles_per_op =
-        (16.0 * 3.0 + 3.0) / 16.0; /* 3-cyc-latency dep MUL */
-    results[2].freq_mhz =
-        results[2].ops_per_sec * results[2].cycles_per_op / 1e6;
-    results[2].model_note = "A7: 3-cyc latency dep MUL";
+    set_result(&results[0], "dep_add", "Dependent integer ADD",
+               bench_dep_add(loops), 16, m->dep_add, m, "dep ALU");
+    set_result(&results[1], "indep_add",
+               "Independent integer ADD pair (dual-issue)",
+               bench_indep_add(loops), 32, m->indep_add, m,
+               "independent ALU");
+    set_result(&results[2], "dep_mul", "Dependent integer MUL",
+               bench_dep_mul(loops), 16, m->dep_mul, m, "dep MUL");
 
     cJSON *j_inner = cJSON_CreateObject();
-    ADD_PARAM(
-        "model",
-        "Cortex-A7 in-order, 3-cyc outer-loop overhead, 16-op inner block");
-    ADD_PARAM_NUM("loops", (double)loops);
-
     cJSON *patterns = cJSON_CreateObject();
-    for (size_t i = 0; i < sizeof(results) / sizeof(results[0]); i++) {
+    for (size_t i = 0; i < ARRCNT(results); i++) {
         cJSON_AddItemToObject(patterns, results[i].name,
                               result_to_json(&results[i]));
     }
@@ -163,38 +310,126 @@ static cJSON *build_cpubench_json(uint64_t loops) {
     double spread_pct = (v[2] - v[0]) / median * 100.0;
     ADD_PARAM_NUM("consensus_freq_mhz", median);
     ADD_PARAM_NUM("spread_pct", spread_pct);
+    *consensus = median;
+    return j_inner;
+}
+
+static void move_items(cJSON *from, cJSON *to) {
+    cJSON *item;
+    while ((item = from->child)) {
+        cJSON_DetachItemViaPointer(from, item);
+        cJSON_AddItemToObject(to, item->string, item);
+    }
+}
+
+cJSON *cpubench_build_json(uint64_t loops, int only_cpu) {
+    int ncpus = sysconf(_SC_NPROCESSORS_CONF);
+    if (ncpus < 1)
+        ncpus = 1;
+    if (ncpus > MAX_CPUS)
+        ncpus = MAX_CPUS;
+    const struct cpu_model *model[MAX_CPUS];
+    detect_models(model, ncpus);
+
+    cpu_set_t saved;
+    bool restore = !sched_getaffinity(0, sizeof(saved), &saved);
+
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM_FMT("model",
+                  "%s, 3-cyc outer-loop overhead, 16-op inner block",
+                  model[only_cpu >= 0 && only_cpu < ncpus ? only_cpu : 0]
+                      ->name);
+    ADD_PARAM_NUM("loops", (double)loops);
+
+    cJSON *cores = cJSON_CreateArray();
+    cJSON *first = NULL;
+    double lo = 0, hi = 0;
+    for (int cpu = 0; cpu < ncpus; cpu++) {
+        if (only_cpu >= 0 && cpu != only_cpu)
+            continue;
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        /* Fails for offline cores */
+        if (sched_setaffinity(0, sizeof(set), &set))
+            continue;
+
+        double mhz;
+        cJSON *core = bench_core(loops, model[cpu], &mhz);
+        if (!first) {
+            first = cJSON_Duplicate(core, true);
+            lo = hi = mhz;
+        } else {
+            lo = MIN(lo, mhz);
+            hi = MAX(hi, mhz);
+        }
+
+        cJSON *j_core = cJSON_CreateObject();
+        cJSON_AddItemToObject(j_core, "cpu", cJSON_CreateNumber(cpu));
+        cJSON_AddItemToObject(j_core, "core",
+                              cJSON_CreateString(model[cpu]->name));
+        double kernel_mhz = cpufreq_mhz(cpu);
+        if (kernel_mhz)
+            cJSON_AddItemToObject(j_core, "cpufreq_mhz",
+                                  cJSON_CreateNumber(kernel_mhz));
+        move_items(core, j_core);
+        cJSON_Delete(core);
+        cJSON_AddItemToArray(cores, j_core);
+    }
+    if (restore)
+        sched_setaffinity(0, sizeof(saved), &saved);
+
+    if (!first) {
+        cJSON_Delete(cores);
+        cJSON_Delete(j_inner);
+        return NULL;
+    }
+
+    /* First measured core also at the top level, where single-core
+     * output used to put it */
+    move_items(first, j_inner);
+    cJSON_Delete(first);
+    if (cJSON_GetArraySize(cores) > 1)
+        ADD_PARAM_NUM("core_spread_pct", (hi - lo) / hi * 100.0);
+    cJSON_AddItemToObject(j_inner, "cores", cores);
     return j_inner;
 }
 
 static void print_cpubench_usage(void) {
-    printf("Usage: ipctool cpubench [--json] [--loops N]\n"
+    printf("Usage: ipctool cpubench [--json] [--loops N] [--cpu N]\n"
            "\n"
            "Triangulate CPU clock by running three tight inline-asm patterns\n"
            "(dependent ADD, independent ADD pair, dependent MUL) and\n"
-           "back-calculating MHz from the known Cortex-A7 throughput.\n"
+           "back-calculating MHz from the known per-core throughput\n"
+           "(Cortex-A/ARM11/ARM9, aarch64 Cortex-A5x/A7x, Ingenic XBurst).\n"
+           "Runs pinned on every online core in turn, or only on --cpu N.\n"
            "\n"
            "Three independent timing models converge to within ~2%% on a\n"
            "healthy chip; large divergence suggests CPU contention (kill\n"
-           "majestic/encoder first) or a non-A7 core.\n"
+           "majestic/encoder first) or a core without a cycle model. Cores\n"
+           "well below their siblings or their cpufreq_mhz are throttled.\n"
            "\n"
            "Output is YAML by default; --json emits JSON.\n"
-           "Default loops = 30000000 (~5-7 s of runtime on Cortex-A7 @ ~900 "
+           "Default loops = 30000000 (~5-7 s per core on Cortex-A7 @ ~900 "
            "MHz).\n");
 }
 
 int cpubench_cmd(int argc, char **argv) {
     bool want_json = false;
     uint64_t loops = 30000000ULL;
+    int only_cpu = -1;
 
     const struct option long_options[] = {
         {"json", no_argument, NULL, 'j'},
         {"loops", required_argument, NULL, 'l'},
+        {"cpu", required_argument, NULL, 'c'},
         {"help", no_argument, NULL, 'h'},
         {NULL, 0, NULL, 0},
     };
     int opt;
     optind = 1;
-    while ((opt = getopt_long(argc, argv, "jl:h", long_options, NULL)) != -1) {
+    while ((opt = getopt_long(argc, argv, "jl:c:h", long_options, NULL)) !=
+           -1) {
         switch (opt) {
         case 'j':
             want_json = true;
@@ -206,6 +441,14 @@ int cpubench_cmd(int argc, char **argv) {
                 return EXIT_FAILURE;
             }
             break;
+        case 'c':
+            only_cpu = atoi(optarg);
+            if (only_cpu < 0 || only_cpu >= MAX_CPUS) {
+                fprintf(stderr, "cpubench: --cpu must be 0..%d\n",
+                        MAX_CPUS - 1);
+                return EXIT_FAILURE;
+            }
+            break;
         case 'h':
             print_cpubench_usage();
             return EXIT_SUCCESS;
@@ -215,7 +458,11 @@ int cpubench_cmd(int argc, char **argv) {
         }
     }
 
-    cJSON *bench = build_cpubench_json(loops);
+    cJSON *bench = cpubench_build_json(loops, only_cpu);
+    if (!bench) {
+        fprintf(stderr, "cpubench: no online CPU to run on\n");
+        return EXIT_FAILURE;
+    }
     cJSON *root = cJSON_CreateObject();
     cJSON_AddItemToObject(root, "cpubench", bench);
 
@@ -230,15 +477,27 @@ int cpubench_cmd(int argc, char **argv) {
     return EXIT_SUCCESS;
 }
 
-#else /* !__arm__ */
+#else /* no inline-asm patterns for this architecture */
+
+double cpubench_dep_add_mhz(uint64_t loops) {
+    (void)loops;
+    return 0;
+}
+
+cJSON *cpubench_build_json(uint64_t loops, int only_cpu) {
+    (void)loops;
+    (void)only_cpu;
+    return NULL;
+}
 
 int cpubench_cmd(int argc, char **argv) {
     (void)argc;
     (void)argv;
     fprintf(stderr,
-            "cpubench: only supported on ARM builds (the inline-asm patterns\n"
-            "          rely on Cortex-A7 throughput numbers).\n");
+            "cpubench: only supported on ARM, aarch64 and MIPS32 builds\n"
+            "          (the inline-asm patterns rely on known per-core\n"
+            "          throughput numbers).\n");
     return EXIT_FAILURE;
 }
 
-#endif /* __arm__ */
+#endif
@@ -1,6 +1,21 @@
 #ifndef CPUBENCH_H
 #define CPUBENCH_H
 
+#include <stdint.h>
+
+#include "cjson/cJSON.h"
+
 int cpubench_cmd(int argc, char **argv);
 
+/* `loops` iterations of every pattern on each online core (or only on
+ * `only_cpu` when >= 0), as printed by `ipctool cpubench`. NULL when no
+ * core could be used or the architecture has no patterns. */
+cJSON *cpubench_build_json(uint64_t loops, int only_cpu);
+
+/* Runs `loops` 16-op blocks of the dependent-ADD pattern on the calling
+ * thread and returns the clock they imply for the core it ran on, using
+ * that core's cycle model and the thread's CPU time. Returns 0 right away
+ * on architectures without the inline-asm patterns. */
+double cpubench_dep_add_mhz(uint64_t loops);
+
 #endif /* CPUBENCH_H */
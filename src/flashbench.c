@@ -0,0 +1,528 @@
+/* `ipctool flashbench` -- SPI NOR / NAND throughput benchmark.
+ *
+ * Read side (always safe): for several block sizes, reads --size MB of
+ * one MTD partition sequentially and at random block-aligned offsets,
+ * once through read() on /dev/mtdN (raw, no page cache) and once by
+ * copying out of an mmap of /dev/mtdblockN (unmapped and page cache
+ * dropped before every pass, so faults go to flash with the block layer's
+ * readahead).
+ *
+ * Write side (only with --write mtdN[:BLOCKS], NOR only): the named
+ * partition must not be the root filesystem, mounted or attached to UBI.
+ * Bootloader, environment and kernel partitions, and anything placed
+ * before rootfs, also need --force: a power cut there bricks the board.
+ * The last BLOCKS erase blocks of the partition are used, as the likely
+ * free tail. Each block is saved to RAM, then erased, programmed with a
+ * pattern and written back with the saved content, timing erase and
+ * program separately. The original data is restored even if a step fails half
+ * way. NAND is refused: writing back in-band data alone loses the OOB
+ * area (JFFS2 cleanmarkers) and turns erased pages into written ones.
+ *
+ * With erase and program costs known, restore (every block of the chip)
+ * and upgrade (kernel + rootfs) are estimated the way do_flash() spends
+ * them: erase, program and read-back verify per erase block.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "chipid.h"
+#include "cjson/cJSON.h"
+#include "cjson/cYAML.h"
+#include "flashbench.h"
+#include "hal/common.h"
+#include "mtd.h"
+#include "tools.h"
+
+#define MTD_NORFLASH 3
+#define MTD_NANDFLASH 4
+#define MAX_PARTS 20
+#define DEFAULT_WRITE_BLOCKS 4
+
+static const size_t block_sizes[] = {4096, 65536, 1048576};
+
+struct part {
+    int num;
+    char name[64];
+    struct mtd_info_user info;
+};
+
+struct parts {
+    struct part p[MAX_PARTS];
+    int n;
+};
+
+static bool collect_part(int i, const char *name, struct mtd_info_user *mtd,
+                         void *ctx) {
+    struct parts *c = ctx;
+    if (c->n == MAX_PARTS)
+        return false;
+    struct part *p = &c->p[c->n++];
+    p->num = i;
+    strncpy(p->name, name, sizeof(p->name) - 1);
+    p->info = *mtd;
+    return true;
+}
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static uint32_t xorshift32(uint32_t *s) {
+    uint32_t x = *s;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *s = x;
+}
+
+// Offset of the k-th `bs`-sized access of a pass over `span` bytes
+static size_t pass_offset(bool random, size_t k, size_t bs, size_t span,
+                          uint32_t *seed) {
+    if (!random)
+        return k * bs;
+    return (xorshift32(seed) % (span / bs)) * bs;
+}
+
+// MB/s of one read() pass over /dev/mtdN, 0 on I/O error
+static double pass_read(int fd, size_t bs, size_t bytes, size_t span,
+                        bool random, char *buf) {
+    uint32_t seed = 0x1234567;
+    size_t count = bytes / bs;
+    double t0 = now_sec();
+    for (size_t k = 0; k < count; k++) {
+        off_t off = pass_offset(random, k, bs, span, &seed);
+        // mtdchar already turns corrected NAND bit flips into success
+        if (pread(fd, buf, bs, off) != (ssize_t)bs)
+            return 0;
+    }
+    return bytes / (now_sec() - t0) / 1e6;
+}
+
+// MB/s of one pass over a fresh mmap of /dev/mtdblockN, 0 if unmappable
+static double pass_mmap(int fd, size_t bs, size_t bytes, size_t span,
+                        bool random, char *buf) {
+    // Throw away pages cached by the previous pass; FADV_DONTNEED keeps
+    // pages that are still mapped, so this pass maps the device anew
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    char *map = mmap(NULL, span, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED)
+        return 0;
+    uint32_t seed = 0x1234567;
+    size_t count = bytes / bs;
+    double t0 = now_sec();
+    for (size_t k = 0; k < count; k++)
+        memcpy(buf, map + pass_offset(random, k, bs, span, &seed), bs);
+    double mbps = bytes / (now_sec() - t0) / 1e6;
+    munmap(map, span);
+    return mbps;
+}
+
+static cJSON *bench_reads(const struct part *p, size_t bytes,
+                          double *seq_mbps) {
+    char dev[32];
+    snprintf(dev, sizeof(dev), "/dev/mtd%d", p->num);
+    int fd = open(dev, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, "flashbench: %s: %s\n", dev, strerror(errno));
+        return NULL;
+    }
+    snprintf(dev, sizeof(dev), "/dev/mtdblock%d", p->num);
+    int bfd = open(dev, O_RDONLY);
+
+    char *buf = malloc(block_sizes[ARRCNT(block_sizes) - 1]);
+    cJSON *j_read = cJSON_CreateObject();
+    cJSON *j_mmap = bfd >= 0 ? cJSON_CreateObject() : NULL;
+    for (size_t i = 0; buf && i < ARRCNT(block_sizes); i++) {
+        size_t bs = block_sizes[i];
+        if (bs > bytes)
+            break;
+        char key[16];
+        snprintf(key, sizeof(key), "%zuk", bs / 1024);
+
+        cJSON *j_inner = cJSON_CreateObject();
+        double seq = pass_read(fd, bs, bytes, p->info.size, false, buf);
+        ADD_PARAM_NUM("seq_mb_per_sec", seq);
+        ADD_PARAM_NUM("random_mb_per_sec",
+                      pass_read(fd, bs, bytes, p->info.size, true, buf));
+        cJSON_AddItemToObject(j_read, key, j_inner);
+        // do_flash() verifies whole erase blocks with read()
+        if (bs <= p->info.erasesize)
+            *seq_mbps = seq;
+
+        if (bfd < 0)
+            continue;
+        j_inner = cJSON_CreateObject();
+        ADD_PARAM_NUM("seq_mb_per_sec",
+                      pass_mmap(bfd, bs, bytes, p->info.size, false, buf));
+        ADD_PARAM_NUM("random_mb_per_sec",
+                      pass_mmap(bfd, bs, bytes, p->info.size, true, buf));
+        cJSON_AddItemToObject(j_mmap, key, j_inner);
+    }
+    free(buf);
+    if (bfd >= 0)
+        close(bfd);
+    close(fd);
+
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM_FMT("mtd", "mtd%d", p->num);
+    ADD_PARAM("name", p->name);
+    ADD_PARAM_NUM("bytes_per_pass", (double)bytes);
+    cJSON_AddItemToObject(j_inner, "read", j_read);
+    if (j_mmap)
+        cJSON_AddItemToObject(j_inner, "mmap", j_mmap);
+    return j_inner;
+}
+
+static bool erase_at(int fd, uint32_t off, uint32_t len) {
+    struct erase_info_user ei = {.start = off, .length = len};
+    ioctl(fd, MEMUNLOCK, &ei);
+    return ioctl(fd, MEMERASE, &ei) == 0;
+}
+
+static bool program_at(int fd, uint32_t off, const char *data, size_t len) {
+    return pwrite(fd, data, len, off) == (ssize_t)len;
+}
+
+struct write_stats {
+    double erase_s, program_s; // totals over `blocks`
+    double erase_max_s, program_max_s;
+    int blocks;
+};
+
+static bool bench_block(int fd, uint32_t off, uint32_t es, char *saved,
+                        const char *pattern, struct write_stats *st) {
+    if (pread(fd, saved, es, off) != (ssize_t)es)
+        return false;
+
+    double t0 = now_sec();
+    bool ok = erase_at(fd, off, es);
+    double t1 = now_sec();
+    ok = ok && program_at(fd, off, pattern, es);
+    double t2 = now_sec();
+
+    // Put the original data back whatever happened above
+    bool restored = erase_at(fd, off, es) && program_at(fd, off, saved, es);
+    if (!restored)
+        fprintf(stderr,
+                "flashbench: failed to restore block at 0x%x, data lost!\n",
+                off);
+    if (!ok || !restored)
+        return false;
+
+    st->erase_s += t1 - t0;
+    st->program_s += t2 - t1;
+    st->erase_max_s = MAX(st->erase_max_s, t1 - t0);
+    st->program_max_s = MAX(st->program_max_s, t2 - t1);
+    st->blocks++;
+    return true;
+}
+
+// partitions the board needs to boot, where a failed restore bricks it
+static bool boot_critical(const struct parts *all, const struct part *p) {
+    static const char *const names[] = {"boot", "u-boot", "uboot", "env",
+                                        "kernel"};
+    for (size_t i = 0; i < ARRCNT(names); i++)
+        if (!strcasecmp(p->name, names[i]))
+            return true;
+    // mtd0 holds the bootloader whatever it is called
+    if (p->num == 0)
+        return true;
+    for (int i = 0; i < all->n; i++)
+        if (!strncmp(all->p[i].name, "rootfs", 6))
+            return p->num < all->p[i].num;
+    return false;
+}
+
+static cJSON *bench_writes(const struct parts *all, const struct part *p,
+                           int blocks, bool force, struct write_stats *st) {
+    if (p->info.type == MTD_NANDFLASH) {
+        fprintf(stderr, "flashbench: mtd%d (%s) is NAND, --write would "
+                        "lose its OOB data, refusing\n",
+                p->num, p->name);
+        return NULL;
+    }
+    if (mtd_in_use(p->num, p->name)) {
+        fprintf(stderr, "flashbench: mtd%d (%s) is in use (root, mounted or "
+                        "UBI), refusing to write\n",
+                p->num, p->name);
+        return NULL;
+    }
+    if (!force && boot_critical(all, p)) {
+        fprintf(stderr, "flashbench: mtd%d (%s) is needed to boot, refusing "
+                        "to write without --force\n",
+                p->num, p->name);
+        return NULL;
+    }
+    char dev[32];
+    snprintf(dev, sizeof(dev), "/dev/mtd%d", p->num);
+    int fd = open(dev, O_RDWR | O_SYNC);
+    if (fd < 0) {
+        fprintf(stderr, "flashbench: %s: %s\n", dev, strerror(errno));
+        return NULL;
+    }
+
+    uint32_t es = p->info.erasesize;
+    char *saved = malloc(es), *pattern = malloc(es);
+    if (!saved || !pattern) {
+        free(saved);
+        free(pattern);
+        close(fd);
+        return NULL;
+    }
+    for (uint32_t i = 0; i < es; i++)
+        pattern[i] = i * 0x9d;
+
+    memset(st, 0, sizeof(*st));
+    // the tail of a partition is the part least likely to hold data
+    uint32_t total = p->info.size / es;
+    uint32_t first = total - MIN((uint32_t)blocks, total);
+    for (uint32_t off = first * es; off + es <= p->info.size; off += es) {
+        if (!bench_block(fd, off, es, saved, pattern, st))
+            break;
+    }
+    free(saved);
+    free(pattern);
+    close(fd);
+
+    if (!st->blocks)
+        return NULL;
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM_FMT("mtd", "mtd%d", p->num);
+    ADD_PARAM("name", p->name);
+    ADD_PARAM_NUM("blocks", st->blocks);
+    ADD_PARAM_NUM("erase_ms", st->erase_s / st->blocks * 1e3);
+    ADD_PARAM_NUM("erase_max_ms", st->erase_max_s * 1e3);
+    ADD_PARAM_NUM("erase_kb_per_sec", es / 1024.0 * st->blocks / st->erase_s);
+    ADD_PARAM_NUM("program_ms", st->program_s / st->blocks * 1e3);
+    ADD_PARAM_NUM("program_max_ms", st->program_max_s * 1e3);
+    ADD_PARAM_NUM("program_kb_per_sec",
+                  es / 1024.0 * st->blocks / st->program_s);
+    return j_inner;
+}
+
+// Seconds do_flash() needs for `size` bytes: erase + program + verify
+static double flash_seconds(size_t size, uint32_t es,
+                            const struct write_stats *st, double read_mbps) {
+    double blocks = (double)size / es;
+    double per_block = (st->erase_s + st->program_s) / st->blocks +
+                       (read_mbps > 0 ? es / (read_mbps * 1e6) : 0);
+    return blocks * per_block;
+}
+
+static cJSON *estimate(const struct parts *all, const struct write_stats *st,
+                       double read_mbps) {
+    size_t total = 0, upgrade = 0;
+    for (int i = 0; i < all->n; i++) {
+        const struct part *p = &all->p[i];
+        if (p->info.type != MTD_NORFLASH && p->info.type != MTD_NANDFLASH)
+            continue;
+        total += p->info.size;
+        if (!strcmp(p->name, "kernel") || !strcmp(p->name, "rootfs"))
+            upgrade += p->info.size;
+    }
+    uint32_t es = all->p[0].info.erasesize;
+
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM_NUM("restore_s", flash_seconds(total, es, st, read_mbps));
+    if (upgrade)
+        ADD_PARAM_NUM("upgrade_s", flash_seconds(upgrade, es, st, read_mbps));
+    return j_inner;
+}
+
+static const struct part *find_part(const struct parts *all, const char *spec) {
+    int num;
+    if (sscanf(spec, "mtd%d", &num) != 1 && sscanf(spec, "%d", &num) != 1)
+        num = -1;
+    for (int i = 0; i < all->n; i++)
+        if (all->p[i].num == num || !strcmp(all->p[i].name, spec))
+            return &all->p[i];
+    return NULL;
+}
+
+static const struct part *largest_part(const struct parts *all) {
+    const struct part *p = NULL;
+    for (int i = 0; i < all->n; i++)
+        if (!p || all->p[i].info.size > p->info.size)
+            p = &all->p[i];
+    return p;
+}
+
+// Flash chip description plus read results for `rd`
+static cJSON *build_reads_json(const struct parts *all, const struct part *rd,
+                               size_t mb, double *read_mbps) {
+    cJSON *j_inner = cJSON_CreateObject();
+    const struct part *first = &all->p[0];
+    ADD_PARAM("type", first->info.type == MTD_NANDFLASH ? "nand" : "nor");
+    ADD_PARAM_FMT("block", "%dK", first->info.erasesize / 1024);
+    if (*nor_chip_name || *nor_chip_id) {
+        cJSON *j_chip = cJSON_CreateObject();
+        if (*nor_chip_name)
+            cJSON_AddItemToObject(j_chip, "name",
+                                  cJSON_CreateString(nor_chip_name));
+        if (*nor_chip_id)
+            cJSON_AddItemToObject(j_chip, "id",
+                                  cJSON_CreateString(nor_chip_id));
+        cJSON_AddItemToObject(j_inner, "chip", j_chip);
+    }
+    if (hal_fmc_mode) {
+        const char *fmc_mode = hal_fmc_mode();
+        if (fmc_mode)
+            ADD_PARAM("addr-mode", fmc_mode);
+    }
+
+    size_t bytes = MIN(mb << 20, (size_t)rd->info.size);
+    cJSON *reads = bench_reads(rd, bytes, read_mbps);
+    if (reads)
+        cJSON_AddItemToObject(j_inner, "reads", reads);
+    return j_inner;
+}
+
+cJSON *flashbench_build_json(size_t mb) {
+    getchipname();
+    static struct parts all;
+    all.n = 0;
+    enum_mtd_info(&all, collect_part);
+    if (!all.n)
+        return NULL;
+
+    double read_mbps = 0;
+    return build_reads_json(&all, largest_part(&all), mb, &read_mbps);
+}
+
+static void print_flashbench_usage(void) {
+    printf("Usage: ipctool flashbench [--mtd N|NAME] [--size MB]\n"
+           "                          [--write N|NAME[:BLOCKS]] [--force]\n"
+           "                          [--json]\n"
+           "\n"
+           "Measure flash read throughput (read() on /dev/mtdN and mmap of\n"
+           "/dev/mtdblockN, sequential and random, 4k / 64k / 1024k "
+           "blocks).\n"
+           "\n"
+           "  --mtd N|NAME   partition to read (default: the largest)\n"
+           "  --size MB      bytes read per pass (default: 2)\n"
+           "  --write P[:B]  also time erase / program on the last B erase\n"
+           "                 blocks (default: %d) of unused NOR partition P;\n"
+           "                 every block is saved and written back\n"
+           "                 afterwards. Enables restore / upgrade time\n"
+           "                 estimates\n"
+           "  --force        allow --write on boot, env, kernel and other\n"
+           "                 partitions before rootfs\n"
+           "  --json         machine-readable JSON instead of YAML\n",
+           DEFAULT_WRITE_BLOCKS);
+}
+
+int flashbench_cmd(int argc, char **argv) {
+    const char *read_spec = NULL, *write_spec = NULL;
+    size_t mb = 2;
+    int write_blocks = DEFAULT_WRITE_BLOCKS;
+    bool want_json = false, force = false;
+
+    const struct option long_options[] = {
+        {"mtd", required_argument, NULL, 'm'},
+        {"size", required_argument, NULL, 's'},
+        {"write", required_argument, NULL, 'w'},
+        {"force", no_argument, NULL, 'f'},
+        {"json", no_argument, NULL, 'j'},
+        {"help", no_argument, NULL, 'h'},
+        {NULL, 0, NULL, 0},
+    };
+    int opt;
+    optind = 1;
+    while ((opt = getopt_long(argc, argv, "m:s:w:fjh", long_options, NULL)) !=
+           -1) {
+        switch (opt) {
+        case 'm':
+            read_spec = optarg;
+            break;
+        case 's':
+            mb = strtoul(optarg, NULL, 10);
+            if (mb < 1 || mb > 256) {
+                fprintf(stderr, "flashbench: --size must be 1..256 MB\n");
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'w': {
+            write_spec = optarg;
+            char *colon = strchr(optarg, ':');
+            if (colon) {
+                *colon = '\0';
+                write_blocks = atoi(colon + 1);
+                if (write_blocks < 1) {
+                    fprintf(stderr, "flashbench: bad block count\n");
+                    return EXIT_FAILURE;
+                }
+            }
+            break;
+        }
+        case 'f':
+            force = true;
+            break;
+        case 'j':
+            want_json = true;
+            break;
+        case 'h':
+            print_flashbench_usage();
+            return EXIT_SUCCESS;
+        default:
+            print_flashbench_usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    getchipname();
+    static struct parts all;
+    enum_mtd_info(&all, collect_part);
+    if (!all.n) {
+        fprintf(stderr, "flashbench: no MTD partitions found\n");
+        return EXIT_FAILURE;
+    }
+
+    const struct part *rd =
+        read_spec ? find_part(&all, read_spec) : largest_part(&all);
+    const struct part *wr = write_spec ? find_part(&all, write_spec) : NULL;
+    if (!rd || (write_spec && !wr)) {
+        fprintf(stderr, "flashbench: no such MTD partition '%s'\n",
+                rd ? write_spec : read_spec);
+        return EXIT_FAILURE;
+    }
+
+    double read_mbps = 0;
+    cJSON *j_inner = build_reads_json(&all, rd, mb, &read_mbps);
+
+    if (wr) {
+        struct write_stats st;
+        cJSON *writes = bench_writes(&all, wr, write_blocks, force, &st);
+        if (writes) {
+            cJSON_AddItemToObject(j_inner, "writes", writes);
+            cJSON_AddItemToObject(j_inner, "estimate",
+                                  estimate(&all, &st, read_mbps));
+        }
+    }
+
+    cJSON *root = cJSON_CreateObject();
+    cJSON_AddItemToObject(root, "flashbench", j_inner);
+    char *out = want_json ? cJSON_Print(root) : cYAML_Print(root);
+    if (out) {
+        printf("%s", out);
+        if (want_json)
+            printf("\n");
+        free(out);
+    }
+    bool ok = cJSON_GetObjectItem(j_inner, "reads");
+    cJSON_Delete(root);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
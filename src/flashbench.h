@@ -0,0 +1,14 @@
+#ifndef FLASHBENCH_H
+#define FLASHBENCH_H
+
+#include <stddef.h>
+
+#include "cjson/cJSON.h"
+
+int flashbench_cmd(int argc, char **argv);
+
+/* Read-only pass over the largest MTD partition (`mb` MB per block size),
+ * as `ipctool flashbench` without --write. NULL without MTD. */
+cJSON *flashbench_build_json(size_t mb);
+
+#endif /* FLASHBENCH_H */
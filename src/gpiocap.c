@@ -0,0 +1,364 @@
+/* `ipctool gpio capture` -- software logic analyzer over GPIO data
+ * registers.
+ *
+ * Reads the selected groups through the HiSilicon mask address with all
+ * eight pins enabled (data register + 0x3fc), as fast as the CPU allows,
+ * pinned to one core under SCHED_FIFO. Every sample is one byte per
+ * group in a preallocated, mlock()ed ring buffer, so a long capture keeps
+ * the most recent `--depth` samples. clock_gettime() is only called once
+ * per block of STAMP_EVERY samples (it is a real syscall on some vendor
+ * kernels); sample times inside a block are interpolated and the spread
+ * of per-block sample periods is reported as the sampling jitter.
+ *
+ * Mind that a busy SCHED_FIFO loop starves everything else on that core
+ * for the duration of the capture (RT throttling still leaves ~5%).
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <getopt.h>
+#include <math.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "gpiocap.h"
+#include "regset.h"
+#include "tools.h"
+
+#define STAMP_EVERY 256
+#define ALL_PINS_MASK (0xff << 2)
+// width of capture_opts.groups
+#define MAX_GROUPS 32
+
+struct capture_opts {
+    uint32_t groups; // bitmask of groups to sample, 0 = all with GPIO pins
+    unsigned duration_ms;
+    size_t depth;
+    int cpu;
+    const char *output;
+};
+
+struct capture {
+    int ngroups;
+    int group_ids[32];
+    uint8_t *ring;       // depth x ngroups
+    uint64_t *stamps;    // depth / STAMP_EVERY
+    size_t depth;
+    uint64_t taken;      // total samples, multiple of STAMP_EVERY
+    uint64_t end_ns;
+};
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void go_realtime(int cpu) {
+    if (cpu < 0)
+        cpu = sysconf(_SC_NPROCESSORS_ONLN) - 1;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set))
+        fprintf(stderr, "gpio capture: cannot pin to cpu%d: %s\n", cpu,
+                strerror(errno));
+
+    struct sched_param sp = {.sched_priority =
+                                 sched_get_priority_max(SCHED_FIFO)};
+    if (sched_setscheduler(0, SCHED_FIFO, &sp))
+        fprintf(stderr, "gpio capture: SCHED_FIFO unavailable: %s\n",
+                strerror(errno));
+}
+
+static void run_capture(struct capture *c, regset_t *set, unsigned ms) {
+    uint32_t vals[c->ngroups];
+    size_t nstamps = c->depth / STAMP_EVERY;
+    uint64_t deadline = now_ns() + (uint64_t)ms * 1000000ULL;
+    uint64_t n = 0;
+
+    for (;;) {
+        uint64_t t = now_ns();
+        if (t >= deadline) {
+            c->end_ns = t;
+            break;
+        }
+        c->stamps[(n / STAMP_EVERY) % nstamps] = t;
+
+        uint8_t *slot = c->ring + (n % c->depth) * c->ngroups;
+        for (int k = 0; k < STAMP_EVERY; k++) {
+            regset_read(set, vals);
+            for (int g = 0; g < c->ngroups; g++)
+                slot[g] = vals[g];
+            slot += c->ngroups;
+        }
+        n += STAMP_EVERY;
+    }
+    c->taken = n;
+}
+
+// Time of the block starting at absolute sample `first`
+static uint64_t block_start(const struct capture *c, uint64_t first) {
+    return c->stamps[(first / STAMP_EVERY) % (c->depth / STAMP_EVERY)];
+}
+
+static uint64_t block_end(const struct capture *c, uint64_t first) {
+    if (first + STAMP_EVERY >= c->taken)
+        return c->end_ns;
+    return block_start(c, first + STAMP_EVERY);
+}
+
+static void vcd_id(int n, char id[4]) {
+    int i = 0;
+    do {
+        id[i++] = '!' + n % 94;
+        n /= 94;
+    } while (n && i < 3);
+    id[i] = '\0';
+}
+
+static int write_vcd(const struct capture *c, const size_t *enabled,
+                     FILE *f) {
+    uint64_t valid = MIN(c->taken, (uint64_t)c->depth);
+    uint64_t first = c->taken - valid;
+    if (!valid)
+        return -1;
+
+    // Sample period statistics over whole blocks
+    double sum = 0, sum2 = 0, pmin = INFINITY, pmax = 0;
+    size_t blocks = 0;
+    for (uint64_t s = first; s < c->taken; s += STAMP_EVERY) {
+        double p = (double)(block_end(c, s) - block_start(c, s)) / STAMP_EVERY;
+        sum += p;
+        sum2 += p * p;
+        pmin = MIN(pmin, p);
+        pmax = MAX(pmax, p);
+        blocks++;
+    }
+    double mean = sum / blocks;
+    double sd = sqrt(MAX(sum2 / blocks - mean * mean, 0));
+
+    fprintf(f,
+            "$comment ipctool gpio capture: %llu samples, mean period "
+            "%.1f ns (%.3f MS/s), jitter sd %.1f ns, min %.1f ns, "
+            "max %.1f ns $end\n",
+            (unsigned long long)valid, mean, 1e3 / mean, sd, pmin, pmax);
+    fprintf(f, "$timescale 1ns $end\n$scope module gpio $end\n");
+
+    int pins[c->ngroups][8];
+    int nvars = 0;
+    for (int g = 0; g < c->ngroups; g++) {
+        int group = c->group_ids[g];
+        size_t mask = enabled[group] ? enabled[group] : 0xff;
+        for (int bit = 0; bit < 8; bit++) {
+            pins[g][bit] = -1;
+            if (!(mask >> bit & 1))
+                continue;
+            char id[4];
+            vcd_id(nvars, id);
+            fprintf(f, "$var wire 1 %s GPIO%d_%d $end\n", id, group, bit);
+            pins[g][bit] = nvars++;
+        }
+    }
+    fprintf(f, "$upscope $end\n$enddefinitions $end\n");
+
+    uint64_t t0 = block_start(c, first);
+    const uint8_t *prev = NULL;
+    for (uint64_t s = first; s < c->taken; s++) {
+        const uint8_t *cur = c->ring + (s % c->depth) * c->ngroups;
+        uint64_t bs = s - s % STAMP_EVERY;
+        uint64_t t = block_start(c, bs) +
+                     (block_end(c, bs) - block_start(c, bs)) * (s - bs) /
+                         STAMP_EVERY;
+
+        bool stamped = false;
+        for (int g = 0; g < c->ngroups; g++) {
+            uint8_t diff = prev ? cur[g] ^ prev[g] : 0xff;
+            for (int bit = 0; diff && bit < 8; bit++) {
+                if (!(diff >> bit & 1) || pins[g][bit] < 0)
+                    continue;
+                if (!stamped) {
+                    fprintf(f, "#%llu\n", (unsigned long long)(t - t0));
+                    stamped = true;
+                }
+                char id[4];
+                vcd_id(pins[g][bit], id);
+                fprintf(f, "%d%s\n", cur[g] >> bit & 1, id);
+            }
+        }
+        prev = cur;
+    }
+    fprintf(f, "#%llu\n", (unsigned long long)(c->end_ns - t0));
+
+    printf("captured %llu samples in %.3f ms: %.3f MS/s, period %.1f ns "
+           "(sd %.1f, min %.1f, max %.1f)\n",
+           (unsigned long long)valid, (c->end_ns - t0) / 1e6, 1e3 / mean,
+           mean, sd, pmin, pmax);
+    return 0;
+}
+
+static void print_capture_usage(void) {
+    printf("Usage: ipctool gpio capture [--groups N,M,...] [--duration MS]\n"
+           "                            [--depth SAMPLES] [--cpu N] "
+           "[--output FILE]\n"
+           "\n"
+           "Sample GPIO data registers as fast as possible and save a VCD\n"
+           "file for PulseView / GTKWave.\n"
+           "\n"
+           "  --groups     GPIO groups to sample (default: all with pins "
+           "muxed as GPIO)\n"
+           "  --duration   capture length in ms (default: 1000, max 60000)\n"
+           "  --depth      ring buffer size in samples, last ones are kept\n"
+           "               (default: 1048576)\n"
+           "  --cpu        core to pin the sampler to (default: last online)\n"
+           "  --output     VCD file (default: capture.vcd)\n"
+           "\n"
+           "The sampler runs under SCHED_FIFO and monopolises its core for "
+           "the\n"
+           "duration of the capture.\n");
+}
+
+int gpio_capture(const struct gpiomon_layout *l, int argc, char **argv) {
+    struct capture_opts o = {
+        .duration_ms = 1000,
+        .depth = 1 << 20,
+        .cpu = -1,
+        .output = "capture.vcd",
+    };
+
+    const struct option long_options[] = {
+        {"groups", required_argument, NULL, 'g'},
+        {"duration", required_argument, NULL, 'd'},
+        {"depth", required_argument, NULL, 'n'},
+        {"cpu", required_argument, NULL, 'c'},
+        {"output", required_argument, NULL, 'o'},
+        {"help", no_argument, NULL, 'h'},
+        {NULL, 0, NULL, 0},
+    };
+    int opt;
+    optind = 1;
+    while ((opt = getopt_long(argc, argv, "g:d:n:c:o:h", long_options,
+                              NULL)) != -1) {
+        switch (opt) {
+        case 'g': {
+            char *end = optarg;
+            while (*end) {
+                long g = strtol(end, &end, 10);
+                if (g < 0 || g >= l->groups || g >= MAX_GROUPS ||
+                    (*end && *end != ',')) {
+                    fprintf(stderr, "gpio capture: bad group list\n");
+                    return EXIT_FAILURE;
+                }
+                o.groups |= 1u << g;
+                if (*end)
+                    end++;
+            }
+            break;
+        }
+        case 'd':
+            o.duration_ms = strtoul(optarg, NULL, 10);
+            if (o.duration_ms < 1 || o.duration_ms > 60000) {
+                fprintf(stderr, "gpio capture: --duration must be 1..60000\n");
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'n':
+            o.depth = strtoul(optarg, NULL, 10);
+            if (o.depth < STAMP_EVERY || o.depth > (64 << 20)) {
+                fprintf(stderr, "gpio capture: --depth must be %d..%d\n",
+                        STAMP_EVERY, 64 << 20);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'c':
+            o.cpu = strtol(optarg, NULL, 10);
+            break;
+        case 'o':
+            o.output = optarg;
+            break;
+        case 'h':
+            print_capture_usage();
+            return EXIT_SUCCESS;
+        default:
+            print_capture_usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    struct capture c = {0};
+    uint32_t addrs[MAX_GROUPS];
+    for (int group = 0; group < l->groups && group < MAX_GROUPS; group++) {
+        if (o.groups ? !(o.groups >> group & 1) : !l->enabled[group])
+            continue;
+        c.group_ids[c.ngroups] = group;
+        addrs[c.ngroups++] = l->base + group * l->offset + ALL_PINS_MASK;
+    }
+    if (!c.ngroups) {
+        fprintf(stderr, "gpio capture: no GPIO groups to sample\n");
+        return EXIT_FAILURE;
+    }
+
+    regset_t *set = regset_open(addrs, c.ngroups);
+    if (!set)
+        return EXIT_FAILURE;
+
+    c.depth = o.depth - o.depth % STAMP_EVERY;
+    // the buffers get mlock()ed: running out of RAM here means the OOM
+    // killer, not a failed malloc()
+    size_t need = c.depth * c.ngroups +
+                  c.depth / STAMP_EVERY * sizeof(*c.stamps);
+    long pages = sysconf(_SC_AVPHYS_PAGES), page = sysconf(_SC_PAGESIZE);
+    if (pages > 0 && page > 0 && need / page >= (size_t)pages) {
+        fprintf(stderr,
+                "gpio capture: --depth %zu needs %zu KiB, only %zu KiB "
+                "free\n",
+                c.depth, need >> 10, (size_t)pages * (page >> 10));
+        regset_close(set);
+        return EXIT_FAILURE;
+    }
+    c.ring = malloc(c.depth * c.ngroups);
+    c.stamps = malloc(c.depth / STAMP_EVERY * sizeof(*c.stamps));
+    if (!c.ring || !c.stamps) {
+        fprintf(stderr, "gpio capture: cannot allocate %zu samples\n",
+                c.depth);
+        free(c.ring);
+        free(c.stamps);
+        regset_close(set);
+        return EXIT_FAILURE;
+    }
+    // Fault everything in up front, no page faults while sampling
+    memset(c.ring, 0, c.depth * c.ngroups);
+    memset(c.stamps, 0, c.depth / STAMP_EVERY * sizeof(*c.stamps));
+    mlockall(MCL_CURRENT);
+
+    go_realtime(o.cpu);
+    run_capture(&c, set, o.duration_ms);
+    struct sched_param sp = {0};
+    sched_setscheduler(0, SCHED_OTHER, &sp);
+    regset_close(set);
+
+    int ret = EXIT_FAILURE;
+    FILE *f = fopen(o.output, "w");
+    if (!f) {
+        fprintf(stderr, "gpio capture: %s: %s\n", o.output, strerror(errno));
+    } else {
+        if (!write_vcd(&c, l->enabled, f))
+            ret = EXIT_SUCCESS;
+        fclose(f);
+        if (ret == EXIT_SUCCESS)
+            printf("written to %s\n", o.output);
+    }
+
+    munlockall();
+    free(c.ring);
+    free(c.stamps);
+    return ret;
+}
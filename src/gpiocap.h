@@ -0,0 +1,10 @@
+#ifndef GPIOCAP_H
+#define GPIOCAP_H
+
+#include "gpiomon.h"
+
+// `gpio capture`: samples GPIO groups into a VCD file, only l->enabled
+// is used from the layout
+int gpio_capture(const struct gpiomon_layout *l, int argc, char **argv);
+
+#endif /* GPIOCAP_H */
@@ -0,0 +1,300 @@
+/* GPIO edge monitor behind `ipctool gpio scan`.
+ *
+ * Input pins that the kernel GPIO character device will hand out are
+ * watched through line events: the kernel timestamps every edge in the
+ * interrupt handler, so pulses of any width are seen and the process
+ * sleeps in poll() between them. Everything else (outputs driven by the
+ * streamer through /dev/mem, pins claimed by a driver, kernels without
+ * /dev/gpiochipN) is sampled from the data registers with an adaptive
+ * interval: 1 ms right after activity, backing off to 100 ms when idle.
+ *
+ * Only the GPIO v1 uAPI is used (Linux 4.8+); the definitions are local
+ * so old vendor toolchains without <linux/gpio.h> still build.
+ */
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <linux/types.h>
+
+#include "gpiomon.h"
+#include "regset.h"
+#include "tools.h"
+
+#define GPIOHANDLE_REQUEST_INPUT (1UL << 0)
+#define GPIOEVENT_REQUEST_BOTH_EDGES ((1UL << 0) | (1UL << 1))
+#define GPIOEVENT_EVENT_RISING_EDGE 0x01
+
+struct gpioevent_request {
+    __u32 lineoffset;
+    __u32 handleflags;
+    __u32 eventflags;
+    char consumer_label[32];
+    int fd;
+};
+
+struct gpioevent_data {
+    __u64 timestamp;
+    __u32 id;
+};
+
+struct gpiohandle_data {
+    __u8 values[64];
+};
+
+#define GPIO_GET_LINEEVENT_IOCTL _IOWR(0xB4, 0x04, struct gpioevent_request)
+#define GPIOHANDLE_GET_LINE_VALUES_IOCTL                                       \
+    _IOWR(0xB4, 0x08, struct gpiohandle_data)
+
+#define POLL_MIN_US 1000
+#define POLL_MAX_US 100000
+
+struct pin_state {
+    int fd; // line event fd, -1 if the pin is polled
+    int level;
+    uint64_t since_ns;
+};
+
+static uint64_t clock_ns(clockid_t clk) {
+    struct timespec ts;
+    clock_gettime(clk, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+// Kernels before 5.7 stamp line events with CLOCK_REALTIME, later ones
+// with CLOCK_MONOTONIC. Bring both onto CLOCK_MONOTONIC.
+static uint64_t event_to_mono(uint64_t ts) {
+    uint64_t mono = clock_ns(CLOCK_MONOTONIC);
+    uint64_t real = clock_ns(CLOCK_REALTIME);
+    uint64_t d_mono = ts > mono ? ts - mono : mono - ts;
+    uint64_t d_real = ts > real ? ts - real : real - ts;
+    if (d_real < d_mono)
+        return mono - (real - ts);
+    return ts;
+}
+
+static bool read_sys_int(const char *path, long *out) {
+    FILE *f = fopen(path, "r");
+    if (!f)
+        return false;
+    bool ok = fscanf(f, "%ld", out) == 1;
+    fclose(f);
+    return ok;
+}
+
+/* Resolves a global Linux GPIO number into its character device and line
+ * offset by matching it against /sys/class/gpio/gpiochip<base> ranges. */
+static bool find_gpiochip(int gpio, char *dev, size_t devlen,
+                          unsigned *offset) {
+    DIR *dir = opendir("/sys/class/gpio");
+    if (!dir)
+        return false;
+
+    bool found = false;
+    struct dirent *ent;
+    while (!found && (ent = readdir(dir))) {
+        if (strncmp(ent->d_name, "gpiochip", 8))
+            continue;
+
+        char path[PATH_MAX];
+        long base, ngpio;
+        snprintf(path, sizeof(path), "/sys/class/gpio/%s/base", ent->d_name);
+        if (!read_sys_int(path, &base))
+            continue;
+        snprintf(path, sizeof(path), "/sys/class/gpio/%s/ngpio", ent->d_name);
+        if (!read_sys_int(path, &ngpio))
+            continue;
+        if (gpio < base || gpio >= base + ngpio)
+            continue;
+
+        // The parent device lists the chardev node as gpiochipN
+        snprintf(path, sizeof(path), "/sys/class/gpio/%s/device", ent->d_name);
+        DIR *pdir = opendir(path);
+        if (!pdir)
+            break;
+        struct dirent *pent;
+        while ((pent = readdir(pdir))) {
+            int n;
+            if (sscanf(pent->d_name, "gpiochip%d", &n) == 1) {
+                snprintf(dev, devlen, "/dev/gpiochip%d", n);
+                *offset = gpio - base;
+                found = access(dev, R_OK) == 0;
+                break;
+            }
+        }
+        closedir(pdir);
+    }
+    closedir(dir);
+    return found;
+}
+
+static int request_line_events(int gpio) {
+    char dev[64];
+    unsigned offset;
+    if (!find_gpiochip(gpio, dev, sizeof(dev), &offset))
+        return -1;
+
+    int chip = open(dev, O_RDONLY);
+    if (chip < 0)
+        return -1;
+
+    struct gpioevent_request req = {
+        .lineoffset = offset,
+        .handleflags = GPIOHANDLE_REQUEST_INPUT,
+        .eventflags = GPIOEVENT_REQUEST_BOTH_EDGES,
+    };
+    strncpy(req.consumer_label, "ipctool", sizeof(req.consumer_label) - 1);
+    int ret = ioctl(chip, GPIO_GET_LINEEVENT_IOCTL, &req);
+    close(chip);
+    // EBUSY: line is owned by a driver or exported via sysfs
+    return ret < 0 ? -1 : req.fd;
+}
+
+static void report_edge(const struct gpiomon_layout *l, int group, int bit,
+                        int level, uint64_t ts, uint64_t t0,
+                        struct pin_state *pin, bool irq, unsigned poll_us) {
+    size_t mask_addr = l->base + group * l->offset + (1 << (bit + 2));
+    double at = (ts - t0) / 1e9;
+    double width_ms = (ts - pin->since_ns) / 1e6;
+
+    printf("[%11.6f] GPIO%d_%d, GPIO%d, Dir:%s, Level:%d, was %d for "
+           "%.3f ms",
+           at, group, bit, group * 8 + bit,
+           (l->direction[group] >> bit & 1) ? "Output" : "Input", level,
+           pin->level, width_ms);
+    if (irq)
+        printf(" (irq)");
+    else
+        printf(" (poll, +-%.1f ms)", poll_us / 1000.0);
+    printf(", Mask: \"devmem 0x%08zX 32 0x%02X\"\n", mask_addr,
+           level << bit);
+    fflush(stdout);
+
+    pin->level = level;
+    pin->since_ns = ts;
+}
+
+int gpio_monitor(const struct gpiomon_layout *l, bool force_poll) {
+    int groups = l->groups;
+    struct pin_state pins[groups][8];
+    struct pollfd pfds[groups * 8];
+    int pfd_pin[groups * 8];
+    int nfds = 0;
+
+    uint64_t t0 = clock_ns(CLOCK_MONOTONIC);
+    size_t poll_bits[groups];
+    for (int group = 0; group < groups; group++) {
+        poll_bits[group] = l->enabled[group];
+        for (int bit = 0; bit < 8; bit++) {
+            struct pin_state *pin = &pins[group][bit];
+            pin->fd = -1;
+            pin->level = l->state[group] >> bit & 1;
+            pin->since_ns = t0;
+
+            if (force_poll || !(l->enabled[group] >> bit & 1) ||
+                (l->direction[group] >> bit & 1))
+                continue;
+            pin->fd = request_line_events(group * 8 + bit);
+            if (pin->fd < 0)
+                continue;
+
+            // Resync with the level the kernel sees now that the line
+            // is ours
+            struct gpiohandle_data data;
+            if (!ioctl(pin->fd, GPIOHANDLE_GET_LINE_VALUES_IOCTL, &data))
+                pin->level = data.values[0];
+
+            poll_bits[group] &= ~(1u << bit);
+            pfds[nfds].fd = pin->fd;
+            pfds[nfds].events = POLLIN;
+            pfd_pin[nfds++] = group * 8 + bit;
+        }
+    }
+
+    // Groups that still have polled pins are read in one regset pass
+    uint32_t addrs[groups];
+    int poll_group[groups];
+    int npolled = 0;
+    for (int group = 0; group < groups; group++) {
+        if (!poll_bits[group])
+            continue;
+        addrs[npolled] = l->base + group * l->offset + (poll_bits[group] << 2);
+        poll_group[npolled++] = group;
+    }
+    regset_t *set = npolled ? regset_open(addrs, npolled) : NULL;
+    if (npolled && !set) {
+        fprintf(stderr, "gpio: cannot map GPIO data registers\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("Watching %d pin(s) via line events, %d group(s) via register "
+           "polling\n",
+           nfds, npolled);
+    if (!nfds && !set)
+        return EXIT_FAILURE;
+
+    unsigned poll_us = POLL_MIN_US;
+    uint32_t values[npolled ? npolled : 1];
+    while (1) {
+        int timeout = set ? (int)(poll_us / 1000) : -1;
+        int ready = poll(pfds, nfds, timeout);
+        if (ready < 0 && errno != EINTR) {
+            perror("poll");
+            break;
+        }
+
+        for (int i = 0; ready > 0 && i < nfds; i++) {
+            if (!(pfds[i].revents & POLLIN))
+                continue;
+            int group = pfd_pin[i] / 8, bit = pfd_pin[i] % 8;
+            // One event per wakeup so read() never blocks; queued edges
+            // keep the fd readable for the next poll()
+            struct gpioevent_data ev;
+            if (read(pfds[i].fd, &ev, sizeof(ev)) != sizeof(ev))
+                continue;
+            int level = ev.id == GPIOEVENT_EVENT_RISING_EDGE;
+            report_edge(l, group, bit, level, event_to_mono(ev.timestamp), t0,
+                        &pins[group][bit], true, 0);
+        }
+
+        if (!set)
+            continue;
+
+        regset_read(set, values);
+        uint64_t now = clock_ns(CLOCK_MONOTONIC);
+        bool changed = false;
+        for (int i = 0; i < npolled; i++) {
+            int group = poll_group[i];
+            for (int bit = 0; bit < 8; bit++) {
+                if (!(poll_bits[group] >> bit & 1))
+                    continue;
+                int level = values[i] >> bit & 1;
+                if (level == pins[group][bit].level)
+                    continue;
+                report_edge(l, group, bit, level, now, t0, &pins[group][bit],
+                            false, poll_us);
+                changed = true;
+            }
+        }
+
+        // Adaptive interval: tight after activity, relaxed while idle
+        if (changed)
+            poll_us = POLL_MIN_US;
+        else if (poll_us < POLL_MAX_US)
+            poll_us = MIN(poll_us * 2, POLL_MAX_US);
+    }
+
+    for (int i = 0; i < nfds; i++)
+        close(pfds[i].fd);
+    regset_close(set);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,21 @@
+#ifndef GPIOMON_H
+#define GPIOMON_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// HiSilicon-style GPIO block layout plus the state `gpio scan` printed
+struct gpiomon_layout {
+    size_t base;
+    size_t offset;
+    int groups;
+    const size_t *enabled;   // pins muxed as GPIO, per group
+    const size_t *state;     // initial data register values
+    const size_t *direction; // direction registers, 1 = output
+};
+
+// Reports every edge with its timestamp and the width of the previous
+// level; runs until interrupted
+int gpio_monitor(const struct gpiomon_layout *l, bool force_poll);
+
+#endif /* GPIOMON_H */
@@ -135,10 +135,9 @@ unsigned int sony_i2c_to_spi(unsigned int reg_addr) {
         return reg_addr;
 }
 
-static int universal_spi_read_register(int fd, unsigned char i2c_addr,
-                                       unsigned int reg_addr,
-                                       unsigned int reg_width,
-                                       unsigned int data_width) {
+int universal_spi_read_register(int fd, unsigned char i2c_addr,
+                                unsigned int reg_addr, unsigned int reg_width,
+                                unsigned int data_width) {
     (void)i2c_addr;
     (void)reg_width;
     (void)data_width;
@@ -113,6 +113,9 @@ int universal_i2c_write_register(int fd, unsigned char i2c_addr,
 int universal_i2c_read_register(int fd, unsigned char i2c_addr,
                                 unsigned int reg_addr, unsigned int reg_width,
                                 unsigned int data_width);
+int universal_spi_read_register(int fd, unsigned char i2c_addr,
+                                unsigned int reg_addr, unsigned int reg_width,
+                                unsigned int data_width);
 unsigned int sony_i2c_to_spi(unsigned int reg_addr);
 
 unsigned long kernel_mem();
@@ -35,4 +35,19 @@ unsigned long hisi_totalmem(unsigned long *media_mem);
 bool hisi_detect_cpu(char *chip_name, uint32_t SC_CTRL_base);
 void setup_hal_hisi();
 
+int hisi_gen1_sensor_read_register(int fd, unsigned char i2c_addr,
+                                   unsigned int reg_addr,
+                                   unsigned int reg_width,
+                                   unsigned int data_width);
+int hisi_gen2_sensor_read_register(int fd, unsigned char i2c_addr,
+                                   unsigned int reg_addr,
+                                   unsigned int reg_width,
+                                   unsigned int data_width);
+int hisi_sensor_read_register(int fd, unsigned char i2c_addr,
+                              unsigned int reg_addr, unsigned int reg_width,
+                              unsigned int data_width);
+int sony_ssp_read_register(int fd, unsigned char i2c_addr,
+                           unsigned int reg_addr, unsigned int reg_width,
+                           unsigned int data_width);
+
 #endif /* HAL_HISI_H */
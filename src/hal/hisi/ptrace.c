@@ -532,50 +532,53 @@ size_t hisi_sizeof_vi_dev_attr() {
     }
 }
 
+// where the hisi_dump_*() entry points print
+static FILE *dump_out;
+
 static void puttabs(int cnt) {
     for (int i = 0; i < cnt; i++)
-        putchar('\t');
+        fputc('\t', dump_out);
 }
 
 #define BRACKET_OPEN                                                           \
     do {                                                                       \
         puttabs(level++);                                                      \
-        puts("{");                                                             \
+        fputs("{\n", dump_out);                                                \
     } while (0)
 
 #define BRACKET_CLOSE                                                          \
     do {                                                                       \
         puttabs(--level);                                                      \
-        puts("},");                                                            \
+        fputs("},\n", dump_out);                                               \
     } while (0)
 
 #define ENUM_PARAM(name, p)                                                    \
     puttabs(level);                                                            \
-    printf("." #name " = %s,\n", name##_str((int)p))
+    fprintf(dump_out, "." #name " = %s,\n", name##_str((int)p))
 
 #define ENUM_TYPED_PARAM(name, type, p)                                        \
     puttabs(level);                                                            \
-    printf("." #name " = %s,\n", type##_str((int)p))
+    fprintf(dump_out, "." #name " = %s,\n", type##_str((int)p))
 
 #define INT_PARAM(name, p)                                                     \
     puttabs(level);                                                            \
-    printf("." #name " = %d,\n", p)
+    fprintf(dump_out, "." #name " = %d,\n", p)
 
 #define STRUCT_PARAM(name, fmt, ...)                                           \
     puttabs(level);                                                            \
-    printf("." #name " = " fmt ",\n", __VA_ARGS__)
+    fprintf(dump_out, "." #name " = " fmt ",\n", __VA_ARGS__)
 
 #define DEFINE_VAR(name)                                                       \
     puttabs(level++);                                                          \
-    printf(#name " = {\n")
+    fprintf(dump_out, #name " = {\n")
 
 #define INT_ARRAY(name, data)                                                  \
     puttabs(level);                                                            \
-    printf("." #name " = {");                                                  \
+    fprintf(dump_out, "." #name " = {");                                       \
     for (size_t i = 0; i < ARRCNT(data); i++) {                                \
-        printf("%s%d", i != 0 ? ", " : "", data[i]);                           \
+        fprintf(dump_out, "%s%d", i != 0 ? ", " : "", data[i]);                \
     }                                                                          \
-    puts("},")
+    fputs("},\n", dump_out)
 
 static void vsync_type(lvds_vsync_attr_t *attr, int level) {
     DEFINE_VAR(.vsync_type);
@@ -599,10 +602,10 @@ static void sync_code(unsigned short *sync_code, int x, int y, int level) {
         for (int j = 0; j < y; j++) {
             puttabs(level);
             for (int m = 0; m < SYNC_CODE_NUM; m++) {
-                printf("%s%#x", m != 0 ? ", " : "{",
-                       sync_code[i * x + j * y + m]);
+                fprintf(dump_out, "%s%#x", m != 0 ? ", " : "{",
+                        sync_code[i * x + j * y + m]);
             }
-            puts("},");
+            fputs("},\n", dump_out);
         }
         BRACKET_CLOSE;
     }
@@ -658,7 +661,7 @@ static void hisi_dump_V2combo_dev_attr(V2_combo_dev_attr_t *attr,
     } else if (attr->input_mode == INPUT_MODE_LVDS) {
         V2_dump_lvds_dev_attr(&attr->lvds_attr, level);
     }
-    puts("};");
+    fputs("};\n", dump_out);
 }
 
 static void hisi_dump_V3Acombo_dev_attr(V3A_combo_dev_attr_t *attr,
@@ -679,7 +682,7 @@ static void hisi_dump_V3Acombo_dev_attr(V3A_combo_dev_attr_t *attr,
     } else if (attr->input_mode == INPUT_MODE_LVDS) {
         V3A_dump_lvds_dev_attr(&attr->lvds_attr, level);
     }
-    puts("};");
+    fputs("};\n", dump_out);
 }
 
 static void hisi_dump_V3combo_dev_attr(V3_combo_dev_attr_t *attr,
@@ -710,7 +713,7 @@ static void hisi_dump_V3combo_dev_attr(V3_combo_dev_attr_t *attr,
                   WDR_VC_NUM, level);
         BRACKET_CLOSE;
     }
-    puts("};");
+    fputs("};\n", dump_out);
 }
 
 static void hisi_dump_V4Acombo_dev_attr(V4A_combo_dev_attr_t *attr,
@@ -731,7 +734,7 @@ static void hisi_dump_V4Acombo_dev_attr(V4A_combo_dev_attr_t *attr,
     } else if (attr->input_mode == INPUT_MODE_LVDS) {
         V4A_dump_lvds_dev_attr(&attr->lvds_attr, level);
     }
-    puts("};");
+    fputs("};\n", dump_out);
 }
 
 static void hisi_dump_V4combo_dev_attr(V4_combo_dev_attr_t *attr,
@@ -763,7 +766,7 @@ static void hisi_dump_V4combo_dev_attr(V4_combo_dev_attr_t *attr,
                   V4_WDR_VC_NUM, level);
         BRACKET_CLOSE;
     }
-    puts("};");
+    fputs("};\n", dump_out);
 }
 
 static void hisi_dump_V4vi_dev_attr(V4_vi_dev_attr_t *attr, unsigned int cmd) {
@@ -790,10 +793,11 @@ static void hisi_dump_V4vi_dev_attr(V4_vi_dev_attr_t *attr, unsigned int cmd) {
     STRUCT_PARAM(stWDRAttr, "{%d, %d}", attr->stWDRAttr.enWDRMode,
                  attr->stWDRAttr.u32CacheLine);
     INT_PARAM(enDataRate, attr->enDataRate);
-    puts("};");
+    fputs("};\n", dump_out);
 }
 
-void hisi_dump_combo_dev_attr(void *ptr, unsigned int cmd) {
+void hisi_dump_combo_dev_attr(FILE *f, void *ptr, unsigned int cmd) {
+    dump_out = f;
     switch ((cmd >> 16) & 0x1ff) {
     case sizeof(V2_combo_dev_attr_t):
         return hisi_dump_V2combo_dev_attr(ptr, cmd);
@@ -810,7 +814,8 @@ void hisi_dump_combo_dev_attr(void *ptr, unsigned int cmd) {
     }
 }
 
-void hisi_dump_vi_dev_attr(void *ptr, unsigned int cmd) {
+void hisi_dump_vi_dev_attr(FILE *f, void *ptr, unsigned int cmd) {
+    dump_out = f;
     switch ((cmd >> 16) & 0x1ff) {
     case sizeof(V4_vi_dev_attr_t):
         return hisi_dump_V4vi_dev_attr(ptr, cmd);
@@ -1,6 +1,7 @@
 #ifndef HISI_PTRACE_H
 #define HISI_PTRACE_H
 
+#include <stdio.h>
 #include <sys/types.h>
 
 #define HIV2X_MIPI_SET_DEV_ATTR 0X41306D01
@@ -21,7 +22,8 @@
 
 size_t hisi_sizeof_combo_dev_attr();
 size_t hisi_sizeof_vi_dev_attr();
-void hisi_dump_combo_dev_attr(void *ptr, unsigned int cmd);
-void hisi_dump_vi_dev_attr(void *ptr, unsigned int cmd);
+// pretty-print the attrs as C initializers to `f`
+void hisi_dump_combo_dev_attr(FILE *f, void *ptr, unsigned int cmd);
+void hisi_dump_vi_dev_attr(FILE *f, void *ptr, unsigned int cmd);
 
 #endif /* HISI_PTRACE_H */
@@ -1,7 +1,7 @@
 #ifndef HAL_INGENIC_REGINFO_H
 #define HAL_INGENIC_REGINFO_H
 
-#include "reginfo.h"
+#include "pinmux.h"
 
 MUXCTRL(T31_reg0, 0x10010000, "PAPIN")
 MUXCTRL(T31_reg1, 0x10010010, "PAINT")
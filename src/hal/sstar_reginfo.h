@@ -1,7 +1,7 @@
 #ifndef HAL_SSTAR_REGINFO_H
 #define HAL_SSTAR_REGINFO_H
 
-#include "reginfo.h"
+#include "pinmux.h"
 
 MUXCTRL(I6B_reg0, 0x1F207800, "PAD_GPIO0")
 MUXCTRL(I6B_reg1, 0x1F207804, "PAD_GPIO1")
@@ -21,6 +21,8 @@ typedef struct {
 
 #define DATE_BUF_LEN 32
 
+int connect_with_timeout(int sockfd, const struct sockaddr *addr,
+                         socklen_t addrlen, unsigned int timeout_ms);
 char *download(char *hostname, const char *uri, const char *useragent,
                nservers_t *ns, size_t *len, char *date, bool progress);
 int upload(const char *hostname, const char *uri, nservers_t *ns,
@@ -13,7 +13,9 @@
 #include <unistd.h>
 
 #include "backup.h"
+#include "bench.h"
 #include "bootrom.h"
+#include "busbench.h"
 #include "chipid.h"
 #include "cjson/cJSON.h"
 #include "cjson/cYAML.h"
@@ -21,18 +23,25 @@
 #include "cpubench.h"
 #include "ethernet.h"
 #include "firmware.h"
+#include "flashbench.h"
 #include "hal/hisi/hal_hisi.h"
 #include "hwinfo.h"
 #include "i2cspi.h"
 #include "membw.h"
 #include "mtd.h"
+#include "netbench.h"
+#include "profile.h"
 #include "network.h"
 #include "ptrace.h"
 #include "ram.h"
 #include "reginfo.h"
+#include "regwatch.h"
 #include "sensors.h"
+#include "sim.h"
 #include "snstool.h"
+#include "soak.h"
 #include "tools.h"
+#include "trace_rec.h"
 #include "uboot.h"
 #include "version.h"
 #include "watchdog.h"
@@ -100,31 +109,76 @@ void print_usage() {
         "  spidump [--script] <from register> <to register>\n"
         "                            dump data from I2C/SPI device\n"
         "  i2cdetect [-b, --bus]     attempt to detect devices on I2C bus\n"
+        "  i2cbench|spibench [--count N] [--burst BYTES] [--json]\n"
+        "                            sensor register read / write / burst\n"
+        "                            rates, latency and bus clock\n"
         "  reginfo [--script]        dump current status of pinmux registers\n"
-        "  gpio (scan|mux)           GPIO utilities\n"
+        "  gpio (scan|mux|capture)   GPIO utilities\n"
+        "     [scan --poll]          poll registers only, skip line events\n"
         "  clocks|freq [--json]      show CPU/peripheral PLL, DDR clock and\n"
         "                            per-die HPM bin (Hisilicon V4 / Goke "
         "V300\n"
         "                            family only for now)\n"
-        "  cpubench [--json] [--loops N]\n"
-        "                            triangulate CPU clock by running three\n"
-        "                            tight inline-asm patterns (ARM only)\n"
+        "  cpubench [--json] [--loops N] [--cpu N]\n"
+        "                            triangulate CPU clock per core by\n"
+        "                            running three tight inline-asm patterns\n"
+        "                            (ARM, aarch64, MIPS32)\n"
         "  membw [--size MB] [--iters N] [--ops set,...] [--json]\n"
+        "        [--threads N|all] [--kernels] [--latency [--tlb]]\n"
+        "        [--monitor[=S] [--duration S]]\n"
         "                            DDR bandwidth probe (memset / read scan "
         "/\n"
         "                            memcpy)\n"
+        "  soak [--duration S] [--interval S] [--cpu N] [--ddr N] [--json]\n"
+        "                            sustained CPU / DDR load with clock,\n"
+        "                            bandwidth and temperature time series\n"
+        "  flashbench [--mtd N] [--size MB] [--write N[:BLOCKS]] [--force]\n"
+        "             [--json]\n"
+        "                            flash read / erase / program throughput\n"
+        "                            and restore time estimate\n"
+        "  netbench (--server|--client HOST) [--time S] [--reverse]\n"
+        "           [--zerocopy] [--json]\n"
+        "                            TCP throughput test with RTT and\n"
+        "                            retransmits from TCP_INFO\n"
+        "  bench [--suite LIST] [--baseline FILE] [--tolerance PCT]\n"
+        "                            fixed CPU / DDR / flash / bus / hash\n"
+        "                            suite as versioned JSON, exit code 2\n"
+        "                            on regression against a baseline\n"
         "  bootrom [--dump] [--base ADDR] [--size N] [--json]\n"
         "                            inspect or dump the SoC mask-ROM region\n"
         "                            (V4 / V4A: default 0x04000000, 64 KB)\n"
+        "  regwatch [--rate HZ] [--duration S] ADDR[-END][:MASK]...\n"
+        "                            log timestamped changes of physical\n"
+        "                            registers (pinmux / clocks decoded)\n"
         "  sensor monitor            poll AE/exposure registers from the\n"
         "                            running sensor every 2s. Supported:\n"
         "                            SC2315E, IMX291, IMX385.\n"
-        "  trace [--skip=usleep] [--output=PATH] <full/path/to/executable> "
-        "[program arguments]\n"
+        "  trace [--skip=usleep] [--output=PATH [--binary]] [--no-seccomp]\n"
+        "        [--stats[=SECS]] [--quiet] [--timeline=FILE]\n"
+        "        <full/path/to/executable> [program arguments]\n"
+        "  trace --pid=N [--duration=SECS] [options as above]\n"
         "                            dump original firmware calls and data "
         "structures\n"
         "                            (--output= keeps child's stdout/stderr "
-        "untouched)\n"
+        "untouched,\n"
+        "                            --binary writes compact records there,\n"
+        "                            --stats adds per-device call rates and\n"
+        "                            latencies, --quiet prints only those,\n"
+        "                            --timeline writes startup phases as\n"
+        "                            Chrome trace JSON, --pid attaches\n"
+        "                            to a running process)\n"
+        "  trace-decode [--json|--timeline] [FILE]\n"
+        "                            print a `trace --binary` capture as "
+        "pseudocode\n"
+        "  --profile[=FILE] <command>\n"
+        "                            time the command's phases (YAML\n"
+        "                            sections, flash phases) and count\n"
+        "                            register / I2C / SPI / ioctl calls,\n"
+        "                            JSON report to stderr or FILE\n"
+        "  --sim=DIR <command>       run against a captured board profile\n"
+        "                            (register / sensor maps, /proc, /sys\n"
+        "                            and /dev files incl. MTD images)\n"
+        "                            instead of hardware; also IPCTOOL_SIM\n"
         "  -h, --help                this help\n");
 }
 
@@ -141,26 +195,47 @@ void add_yaml_fragment(cJSON *root, const char *key, cJSON *json) {
     cJSON_AddItemToObject(root, key, json);
 }
 
+static cJSON *detect_clocks() { return clocks_build_json(true); }
+
+static const struct {
+    const char *key;
+    cJSON *(*fn)();
+} yaml_sections[] = {
+    {"chip", detect_chip},         {"board", detect_board},
+    {"ethernet", detect_ethernet}, {"rom", get_mtd_info},
+    {"ram", detect_ram},           {"firmware", detect_firmare},
+    {"sensors", detect_sensors},   {"clocks", detect_clocks},
+};
+
 static cJSON *build_yaml() {
-    if (!getchipname()) return NULL;
+    struct prof_scope prof;
+    prof_begin(&prof, "build_yaml", "chipid");
+    const char *chip = getchipname();
+    prof_end(&prof);
+    if (!chip) return NULL;
 
     cJSON *root = cJSON_CreateObject();
-    add_yaml_fragment(root, "chip", detect_chip());
-    add_yaml_fragment(root, "board", detect_board());
-    add_yaml_fragment(root, "ethernet", detect_ethernet());
-    add_yaml_fragment(root, "rom", get_mtd_info());
-    add_yaml_fragment(root, "ram", detect_ram());
-    add_yaml_fragment(root, "firmware", detect_firmare());
-    add_yaml_fragment(root, "sensors", detect_sensors());
-    add_yaml_fragment(root, "clocks", clocks_build_json(true));
+    for (size_t i = 0; i < ARRCNT(yaml_sections); i++) {
+        prof_begin(&prof, "build_yaml", yaml_sections[i].key);
+        add_yaml_fragment(root, yaml_sections[i].key, yaml_sections[i].fn());
+        prof_end(&prof);
+    }
 
     return root;
 }
 
+static char *print_yaml(cJSON *yaml) {
+    struct prof_scope prof;
+    prof_begin(&prof, "build_yaml", "render");
+    char *string = cYAML_Print(yaml);
+    prof_end(&prof);
+    return string;
+}
+
 static int backup_with_yaml(const char *backup_file) {
     cJSON *yaml = build_yaml();
     if (!yaml) return EXIT_FAILURE;
-    char *string = cYAML_Print(yaml);
+    char *string = print_yaml(yaml);
 
     int ret = do_backup(string, strlen(string), backup_file);
     
@@ -169,6 +244,30 @@ static int backup_with_yaml(const char *backup_file) {
 }
 
 int main(int argc, char *argv[]) {
+    const char *sim = getenv("IPCTOOL_SIM");
+    bool profile = false;
+    const char *profile_path = NULL;
+    for (;;) {
+        if (argc > 1 && !strncmp(argv[1], "--profile", 9) &&
+            (!argv[1][9] || argv[1][9] == '=')) {
+            profile = true;
+            profile_path = argv[1][9] ? argv[1] + 10 : NULL;
+            argv[1] = argv[0];
+            argc--;
+            argv++;
+        } else if (argc > 1 && !strncmp(argv[1], "--sim=", 6)) {
+            sim = argv[1] + 6;
+            argv[1] = argv[0];
+            argc--;
+            argv++;
+        } else
+            break;
+    }
+    if (sim && *sim && !sim_init(sim))
+        return EXIT_FAILURE;
+    if (profile)
+        prof_start(argc > 1 ? argv[1] : "report", profile_path);
+
     // Don't use common option parser for these commands
     if (argc > 1) {
         if (!strcmp(argv[1], "gpio"))
@@ -177,6 +276,9 @@ int main(int argc, char *argv[]) {
             return reginfo_cmd(argc - 1, argv + 1);
         else if (!strcmp(argv[1], "watchdog"))
             return watchdog_cmd(argc - 1, argv + 1);
+        else if (!strcmp(argv[1], "i2cbench") ||
+                 !strcmp(argv[1], "spibench"))
+            return busbench_cmd(argc - 1, argv + 1);
         else if (!strncmp(argv[1], "i2c", 3) || !strncmp(argv[1], "spi", 3))
             return i2cspi_cmd(argc - 1, argv + 1);
         else if (!strcmp(argv[1], "restore") || !strcmp(argv[1], "upgrade"))
@@ -197,8 +299,20 @@ int main(int argc, char *argv[]) {
             return cpubench_cmd(argc - 1, argv + 1);
         else if (!strcmp(argv[1], "membw"))
             return membw_cmd(argc - 1, argv + 1);
+        else if (!strcmp(argv[1], "soak"))
+            return soak_cmd(argc - 1, argv + 1);
+        else if (!strcmp(argv[1], "flashbench"))
+            return flashbench_cmd(argc - 1, argv + 1);
+        else if (!strcmp(argv[1], "bench"))
+            return bench_cmd(argc - 1, argv + 1, build_yaml);
+        else if (!strcmp(argv[1], "netbench"))
+            return netbench_cmd(argc - 1, argv + 1);
         else if (!strcmp(argv[1], "bootrom"))
             return bootrom_cmd(argc - 1, argv + 1);
+        else if (!strcmp(argv[1], "regwatch"))
+            return regwatch_cmd(argc - 1, argv + 1);
+        else if (!strcmp(argv[1], "trace-decode"))
+            return trace_decode_cmd(argc - 1, argv + 1);
 #ifdef __arm__
         else if (!strcmp(argv[1], "trace"))
             return ptrace_cmd(argc - 1, argv + 1);
@@ -281,7 +395,7 @@ int main(int argc, char *argv[]) {
 
     cJSON *yaml = build_yaml();
     if (!yaml) return EXIT_FAILURE;
-    char *string = cYAML_Print(yaml);
+    char *string = print_yaml(yaml);
     printf("%s", string);
     free(string);
     cJSON_Delete(yaml);
@@ -21,11 +21,29 @@
  *   - The default of 16 MB × 16 iters processes ~1 GB across all three
  *     ops, which takes <2 s on a healthy V4 board and is light enough
  *     to run with the streamer up.
+ *
+ * `--threads N` sweeps 1..N worker threads, each pinned to its own core
+ * with private buffers (--size is split between them, 4 MB minimum so
+ * every thread still misses L2). All workers start each op on a shared
+ * barrier; aggregate MB/s is total bytes over the wall time from the
+ * first start to the last finish, so the sweep shows where the DDR
+ * controller saturates on multi-core parts (CV500, SSC337, RV1126).
+ *
+ * `--kernels` adds the hand-written, libc-independent kernels from
+ * memkern.c (sequential, strided and random line order) next to the libc
+ * results, as the hardware ceiling to compare them against.
+ *
+ * `--monitor` leaves the one-shot burst aside and keeps a low-duty probe
+ * running (memmon.c) to see how much bandwidth the streamer leaves over.
  */
 
+#define _GNU_SOURCE
+
 #include <errno.h>
 #include <fcntl.h>
 #include <getopt.h>
+#include <pthread.h>
+#include <sched.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -39,6 +57,9 @@
 #include "cjson/cJSON.h"
 #include "cjson/cYAML.h"
 #include "membw.h"
+#include "memkern.h"
+#include "memlat.h"
+#include "memmon.h"
 #include "tools.h"
 
 static double now_sec(void) {
@@ -54,6 +75,13 @@ struct membw_opts {
     bool do_read;
     bool do_copy;
     bool want_json;
+    int threads; /* 0 = classic single-thread run */
+    bool kernels;
+    bool latency;
+    bool tlb;
+    unsigned monitor; /* interval in seconds, 0 = off */
+    unsigned duration;
+    bool size_set;
 };
 
 struct op_result {
@@ -62,6 +90,36 @@ struct op_result {
     double mb_per_sec;
 };
 
+/* Op kernels, shared by the single-threaded run and the thread sweep.
+ * Each returns the number of bytes moved. */
+static double op_write(char *a, char *b, size_t sz, int iters) {
+    (void)b;
+    for (int i = 0; i < iters; i++)
+        memset(a, i & 0xff, sz);
+    return (double)sz * iters;
+}
+
+static double op_read(char *a, char *b, size_t sz, int iters) {
+    (void)b;
+    volatile uint32_t sum = 0;
+    for (int i = 0; i < iters; i++) {
+        uint32_t *p = (uint32_t *)a;
+        size_t n = sz / 4;
+        for (size_t k = 0; k < n; k++)
+            sum += p[k];
+    }
+    /* sink the sum so the optimizer can't elide the loop entirely */
+    (void)sum;
+    return (double)sz * iters;
+}
+
+static double op_copy(char *a, char *b, size_t sz, int iters) {
+    for (int i = 0; i < iters; i++)
+        memcpy(b, a, sz);
+    /* memcpy moves 2× bytes (one read, one write) per byte of buffer */
+    return (double)sz * iters * 2.0;
+}
+
 static cJSON *result_to_json(const struct op_result *r) {
     cJSON *j_inner = cJSON_CreateObject();
     ADD_PARAM_NUM("mb_per_sec", r->mb_per_sec);
@@ -102,54 +160,211 @@ static cJSON *run_bench(const struct membw_opts *o) {
 
     if (o->do_write) {
         double t0 = now_sec();
-        for (int i = 0; i < o->iters; i++)
-            memset(a, i & 0xff, sz);
+        double bytes = op_write(a, b, sz, o->iters);
         double dt = now_sec() - t0;
         struct op_result r = {.name = "write",
                               .duration_s = dt,
-                              .mb_per_sec = (double)sz * o->iters / dt / 1e6};
+                              .mb_per_sec = bytes / dt / 1e6};
         cJSON_AddItemToObject(results, "write", result_to_json(&r));
     }
 
     if (o->do_read) {
-        volatile uint32_t sum = 0;
         double t0 = now_sec();
-        for (int i = 0; i < o->iters; i++) {
-            uint32_t *p = (uint32_t *)a;
-            size_t n = sz / 4;
-            for (size_t k = 0; k < n; k++)
-                sum += p[k];
-        }
+        double bytes = op_read(a, b, sz, o->iters);
         double dt = now_sec() - t0;
         struct op_result r = {.name = "read",
                               .duration_s = dt,
-                              .mb_per_sec = (double)sz * o->iters / dt / 1e6};
+                              .mb_per_sec = bytes / dt / 1e6};
         cJSON_AddItemToObject(results, "read", result_to_json(&r));
-        /* sink the sum so the optimizer can't elide the loop entirely */
-        (void)sum;
     }
 
     if (o->do_copy) {
         double t0 = now_sec();
-        for (int i = 0; i < o->iters; i++)
-            memcpy(b, a, sz);
+        double bytes = op_copy(a, b, sz, o->iters);
         double dt = now_sec() - t0;
-        /* memcpy moves 2× bytes (one read, one write) per byte of buffer */
         struct op_result r = {.name = "copy",
                               .duration_s = dt,
-                              .mb_per_sec =
-                                  (double)sz * o->iters * 2.0 / dt / 1e6};
+                              .mb_per_sec = bytes / dt / 1e6};
         cJSON_AddItemToObject(results, "copy", result_to_json(&r));
     }
 
     cJSON_AddItemToObject(j_inner, "results", results);
 
+    if (o->kernels) {
+        cJSON *kernels = memkern_build_json(a, b, sz, o->iters, o->do_read,
+                                            o->do_write, o->do_copy);
+        if (kernels)
+            cJSON_AddItemToObject(j_inner, "kernels", kernels);
+    }
+
     munmap(a, sz);
     munmap(b, sz);
     close(fd);
     return j_inner;
 }
 
+cJSON *membw_build_json(size_t mb, int iters) {
+    struct membw_opts o = {
+        .mb = mb,
+        .iters = iters,
+        .do_write = true,
+        .do_read = true,
+        .do_copy = true,
+    };
+    return run_bench(&o);
+}
+
+typedef double (*op_fn)(char *a, char *b, size_t sz, int iters);
+
+static const struct {
+    const char *name;
+    op_fn fn;
+} bench_ops[] = {
+    {"write", op_write},
+    {"read", op_read},
+    {"copy", op_copy},
+};
+
+struct worker {
+    pthread_t tid;
+    int cpu;
+    size_t sz;
+    int iters;
+    const bool *enabled; /* per bench_ops[] entry */
+    pthread_barrier_t *barrier;
+    bool ok;
+    double bytes[ARRCNT(bench_ops)];
+    double t0[ARRCNT(bench_ops)];
+    double t1[ARRCNT(bench_ops)];
+};
+
+static void *worker_main(void *arg) {
+    struct worker *w = arg;
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(w->cpu, &set);
+    sched_setaffinity(0, sizeof(set), &set);
+
+    char *a = mmap(NULL, w->sz, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    char *b = mmap(NULL, w->sz, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    w->ok = a != MAP_FAILED && b != MAP_FAILED;
+    if (w->ok) {
+        memset(a, 1, w->sz);
+        memset(b, 2, w->sz);
+    }
+
+    /* Everyone takes part in every barrier even after a failed mmap,
+     * otherwise the other workers would wait forever. */
+    pthread_barrier_wait(w->barrier);
+    for (size_t i = 0; i < ARRCNT(bench_ops); i++) {
+        if (!w->enabled[i])
+            continue;
+        pthread_barrier_wait(w->barrier);
+        if (!w->ok)
+            continue;
+        w->t0[i] = now_sec();
+        w->bytes[i] = bench_ops[i].fn(a, b, w->sz, w->iters);
+        w->t1[i] = now_sec();
+    }
+
+    if (a != MAP_FAILED)
+        munmap(a, w->sz);
+    if (b != MAP_FAILED)
+        munmap(b, w->sz);
+    return NULL;
+}
+
+static cJSON *run_threads(const struct membw_opts *o, int n, int ncpus) {
+    bool enabled[ARRCNT(bench_ops)] = {o->do_write, o->do_read, o->do_copy};
+    struct worker w[n];
+    pthread_barrier_t barrier;
+    pthread_barrier_init(&barrier, NULL, n);
+
+    size_t mb = MAX(o->mb / n, (size_t)4);
+    int started = 0;
+    for (int i = 0; i < n; i++) {
+        memset(&w[i], 0, sizeof(w[i]));
+        w[i].cpu = i % ncpus;
+        w[i].sz = mb * 1024UL * 1024UL;
+        w[i].iters = o->iters;
+        w[i].enabled = enabled;
+        w[i].barrier = &barrier;
+        if (pthread_create(&w[i].tid, NULL, worker_main, &w[i]))
+            break;
+        started++;
+    }
+    if (started != n) {
+        /* Can't recover from a partially populated barrier */
+        fprintf(stderr, "membw: cannot start %d threads\n", n);
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < n; i++)
+        pthread_join(w[i].tid, NULL);
+    pthread_barrier_destroy(&barrier);
+
+    for (int i = 0; i < n; i++) {
+        if (!w[i].ok) {
+            fprintf(stderr, "membw: cannot map 2 x %zu MB for each of %d "
+                            "threads\n",
+                    mb, n);
+            return NULL;
+        }
+    }
+
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM_NUM("threads", n);
+    ADD_PARAM_NUM("buffer_mb", (double)mb);
+    cJSON *results = cJSON_CreateObject();
+    for (size_t op = 0; op < ARRCNT(bench_ops); op++) {
+        if (!enabled[op])
+            continue;
+
+        double first = w[0].t0[op], last = w[0].t1[op], bytes = 0;
+        cJSON *per_thread = cJSON_CreateArray();
+        for (int i = 0; i < n; i++) {
+            first = MIN(first, w[i].t0[op]);
+            last = MAX(last, w[i].t1[op]);
+            bytes += w[i].bytes[op];
+            cJSON_AddItemToArray(per_thread,
+                                 cJSON_CreateNumber(w[i].bytes[op] /
+                                                    (w[i].t1[op] - w[i].t0[op]) /
+                                                    1e6));
+        }
+        struct op_result r = {.name = bench_ops[op].name,
+                              .duration_s = last - first,
+                              .mb_per_sec = bytes / (last - first) / 1e6};
+        cJSON *j_op = result_to_json(&r);
+        cJSON_AddItemToObject(j_op, "per_thread_mb_per_sec", per_thread);
+        cJSON_AddItemToObject(results, r.name, j_op);
+    }
+    cJSON_AddItemToObject(j_inner, "results", results);
+    return j_inner;
+}
+
+static cJSON *run_sweep(const struct membw_opts *o) {
+    int ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (ncpus < 1)
+        ncpus = 1;
+    int max = o->threads ? o->threads : ncpus;
+
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM_NUM("iters", (double)o->iters);
+    ADD_PARAM_NUM("cpus", ncpus);
+
+    cJSON *sweep = cJSON_CreateArray();
+    for (int n = 1; n <= max; n++) {
+        cJSON *step = run_threads(o, n, ncpus);
+        if (!step)
+            break;
+        cJSON_AddItemToArray(sweep, step);
+    }
+    cJSON_AddItemToObject(j_inner, "sweep", sweep);
+    return j_inner;
+}
+
 static bool parse_ops(const char *spec, struct membw_opts *o) {
     o->do_write = o->do_read = o->do_copy = false;
     char buf[64];
@@ -174,6 +389,9 @@ static bool parse_ops(const char *spec, struct membw_opts *o) {
 static void print_membw_usage(void) {
     printf(
         "Usage: ipctool membw [--size MB] [--iters N] [--ops set,...] "
+        "[--threads N|all] [--kernels] [--json]\n"
+        "       ipctool membw --latency [--tlb] [--size MB] [--json]\n"
+        "       ipctool membw --monitor[=S] [--duration S] [--size MB] "
         "[--json]\n"
         "\n"
         "Synthetic DDR bandwidth probe. Runs memset (write) / volatile-sum\n"
@@ -185,6 +403,20 @@ static void print_membw_usage(void) {
         "  --size MB     buffer size per pass (default: 16; must exceed L2)\n"
         "  --iters N     passes per op       (default: 16)\n"
         "  --ops a,b,c   comma list of write / read / copy (default: all)\n"
+        "  --threads N   sweep 1..N pinned threads (`all` = online cores),\n"
+        "                --size is split between threads, 4 MB minimum\n"
+        "  --kernels     also run the libc-independent line kernels (c64 and\n"
+        "                NEON / ldm / ldp / MIPS32 where built) sequentially,\n"
+        "                strided and in random order\n"
+        "  --latency     pointer-chasing latency sweep from 4 KB up to --size\n"
+        "                (default: 64 MB, capped at 1/4 of RAM) with L1 / L2\n"
+        "                / DDR knee detection\n"
+        "  --tlb         with --latency, also run a page-strided TLB sweep\n"
+        "  --monitor[=S] keep a ~1% duty copy probe running and report\n"
+        "                p50 / p95 / p99 MB/s (and SoC temperature) every S\n"
+        "                seconds (default: 1) over a --size ring (default: 8)\n"
+        "  --duration S  stop the monitor after S seconds (default: 60,\n"
+        "                0 = until Ctrl-C)\n"
         "  --json        machine-readable JSON instead of YAML\n"
         "\n"
         "The `read` op is libc-INdependent and the most trustworthy number\n"
@@ -204,20 +436,28 @@ int membw_cmd(int argc, char **argv) {
         .do_read = true,
         .do_copy = true,
         .want_json = false,
+        .duration = 60,
     };
 
     const struct option long_options[] = {
         {"size", required_argument, NULL, 's'},
         {"iters", required_argument, NULL, 'i'},
         {"ops", required_argument, NULL, 'o'},
+        {"threads", required_argument, NULL, 't'},
+        {"kernels", no_argument, NULL, 'K'},
+        {"latency", no_argument, NULL, 'L'},
+        {"tlb", no_argument, NULL, 'T'},
+        {"monitor", optional_argument, NULL, 'm'},
+        {"duration", required_argument, NULL, 'd'},
         {"json", no_argument, NULL, 'j'},
         {"help", no_argument, NULL, 'h'},
         {NULL, 0, NULL, 0},
     };
+    bool sweep = false;
     int opt;
     optind = 1;
-    while ((opt = getopt_long(argc, argv, "s:i:o:jh", long_options, NULL)) !=
-           -1) {
+    while ((opt = getopt_long(argc, argv, "s:i:o:t:KLTm::d:jh", long_options,
+                              NULL)) != -1) {
         switch (opt) {
         case 's': {
             long mb = strtol(optarg, NULL, 10);
@@ -226,6 +466,7 @@ int membw_cmd(int argc, char **argv) {
                 return EXIT_FAILURE;
             }
             o.mb = (size_t)mb;
+            o.size_set = true;
             break;
         }
         case 'i': {
@@ -244,6 +485,39 @@ int membw_cmd(int argc, char **argv) {
                 return EXIT_FAILURE;
             }
             break;
+        case 't': {
+            sweep = true;
+            if (!strcmp(optarg, "all"))
+                break;
+            long t = strtol(optarg, NULL, 10);
+            if (t < 1 || t > 64) {
+                fprintf(stderr, "membw: --threads must be 1..64 or all\n");
+                return EXIT_FAILURE;
+            }
+            o.threads = (int)t;
+            break;
+        }
+        case 'K':
+            o.kernels = true;
+            break;
+        case 'L':
+            o.latency = true;
+            break;
+        case 'T':
+            o.tlb = true;
+            break;
+        case 'm': {
+            long s = optarg ? strtol(optarg, NULL, 10) : 1;
+            if (s < 1 || s > 3600) {
+                fprintf(stderr, "membw: --monitor interval must be 1..3600\n");
+                return EXIT_FAILURE;
+            }
+            o.monitor = (unsigned)s;
+            break;
+        }
+        case 'd':
+            o.duration = strtoul(optarg, NULL, 10);
+            break;
         case 'j':
             o.want_json = true;
             break;
@@ -255,8 +529,37 @@ int membw_cmd(int argc, char **argv) {
             return EXIT_FAILURE;
         }
     }
+    // `--monitor 2` would otherwise run at 1 s and drop the 2
+    if (optind < argc) {
+        fprintf(stderr, "membw: unexpected argument '%s'%s\n", argv[optind],
+                o.monitor ? ", use --monitor=S" : "");
+        return EXIT_FAILURE;
+    }
 
-    cJSON *bench = run_bench(&o);
+    cJSON *bench;
+    if (o.monitor) {
+        cJSON *mon =
+            memmon_build_json(o.size_set ? o.mb : 8, o.monitor, o.duration);
+        bench = NULL;
+        if (mon) {
+            bench = cJSON_CreateObject();
+            cJSON_AddItemToObject(bench, "monitor", mon);
+        }
+    } else if (o.latency) {
+        size_t max_mb = o.size_set ? o.mb : 64;
+        size_t ram_mb = (size_t)sysconf(_SC_PHYS_PAGES) *
+                        sysconf(_SC_PAGESIZE) / (1024 * 1024);
+        if (!o.size_set && max_mb > ram_mb / 4)
+            max_mb = MAX(ram_mb / 4, (size_t)1);
+        cJSON *lat = memlat_build_json(max_mb, o.tlb);
+        bench = NULL;
+        if (lat) {
+            bench = cJSON_CreateObject();
+            cJSON_AddItemToObject(bench, "latency", lat);
+        }
+    } else {
+        bench = sweep ? run_sweep(&o) : run_bench(&o);
+    }
     if (!bench)
         return EXIT_FAILURE;
 
@@ -1,6 +1,14 @@
 #ifndef MEMBW_H
 #define MEMBW_H
 
+#include <stddef.h>
+
+#include "cjson/cJSON.h"
+
 int membw_cmd(int argc, char **argv);
 
+/* Single-threaded write / read / copy over two `mb` MB buffers, as the
+ * default `ipctool membw` run. NULL if the buffers can't be mapped. */
+cJSON *membw_build_json(size_t mb, int iters);
+
 #endif /* MEMBW_H */
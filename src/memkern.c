@@ -0,0 +1,419 @@
+/* `ipctool membw --kernels` -- libc-independent bandwidth ceiling.
+ *
+ * The classic membw numbers go through libc memset/memcpy, which differ
+ * wildly between uClibc, musl and glibc builds of the same firmware. The
+ * kernels here move whole 64-byte lines with the widest load/store the
+ * CPU has and don't depend on libc at all:
+ *
+ *   c64     : unrolled 64-bit C loads/stores, built everywhere
+ *   neon    : 2 x vld1/vst1 {d0-d3} (128-bit NEON) per line, 32-bit ARM
+ *             built with NEON enabled (Cortex-A7 / A9 / A17 SoCs)
+ *   ldm     : 4 x ldmia/stmia of 4 registers per line, 32-bit ARM without
+ *             NEON (ARM926 / ARM1176 SoCs like CV100, CV200)
+ *   ldp_q   : 2 x ldp/stp of q registers per line on aarch64
+ *   mips32  : 16 x lw/sw per line on MIPS32 (Ingenic T-series)
+ *
+ * Sequential passes software-prefetch a few lines ahead (pld / prfm /
+ * pref via __builtin_prefetch). Each kernel is also run in two other
+ * line orders that defeat the hardware prefetcher to a different degree:
+ *
+ *   stride : every 4th line (256 bytes apart), four interleaved passes
+ *   random : every line once, in a fixed pseudo-random permutation
+ *
+ * Both still cover the whole buffer, so MB/s is comparable across
+ * patterns; copy is only run sequentially and counts bytes read plus
+ * bytes written, like the libc copy op.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "cjson/cJSON.h"
+#include "memkern.h"
+#include "tools.h"
+
+#define LINE 64
+#define STRIDE_LINES 4
+#define PREFETCH_AHEAD (4 * LINE)
+
+static volatile uint64_t sink64;
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Per-kernel line primitives: read, write and copy exactly one 64-byte,
+ * 16-byte aligned line. */
+
+static inline void c64_line_read(const char *p) {
+    const uint64_t *s = (const uint64_t *)p;
+    sink64 += (s[0] ^ s[1]) + (s[2] ^ s[3]) + (s[4] ^ s[5]) + (s[6] ^ s[7]);
+}
+
+static inline void c64_line_write(char *p) {
+    uint64_t *d = (uint64_t *)p, v = 0x5a5a5a5a5a5a5a5aULL;
+    d[0] = v;
+    d[1] = v;
+    d[2] = v;
+    d[3] = v;
+    d[4] = v;
+    d[5] = v;
+    d[6] = v;
+    d[7] = v;
+}
+
+static inline void c64_line_copy(char *dst, const char *src) {
+    const uint64_t *s = (const uint64_t *)src;
+    uint64_t *d = (uint64_t *)dst;
+    uint64_t r0 = s[0], r1 = s[1], r2 = s[2], r3 = s[3];
+    uint64_t r4 = s[4], r5 = s[5], r6 = s[6], r7 = s[7];
+    d[0] = r0;
+    d[1] = r1;
+    d[2] = r2;
+    d[3] = r3;
+    d[4] = r4;
+    d[5] = r5;
+    d[6] = r6;
+    d[7] = r7;
+}
+
+#if defined(__arm__) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+#define HAVE_NEON
+
+static inline void neon_line_read(const char *p) {
+    __asm__ __volatile__("vld1.64 {d0-d3}, [%0:128]!\n\t"
+                         "vld1.64 {d4-d7}, [%0:128]\n\t"
+                         : "+r"(p)
+                         :
+                         : "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7",
+                           "memory");
+}
+
+static inline void neon_line_write(char *p) {
+    __asm__ __volatile__("vmov.i8 q0, #0x5a\n\t"
+                         "vmov.i8 q1, #0x5a\n\t"
+                         "vst1.64 {d0-d3}, [%0:128]!\n\t"
+                         "vst1.64 {d0-d3}, [%0:128]\n\t"
+                         : "+r"(p)
+                         :
+                         : "d0", "d1", "d2", "d3", "memory");
+}
+
+static inline void neon_line_copy(char *dst, const char *src) {
+    __asm__ __volatile__("vld1.64 {d0-d3}, [%1:128]!\n\t"
+                         "vld1.64 {d4-d7}, [%1:128]\n\t"
+                         "vst1.64 {d0-d3}, [%0:128]!\n\t"
+                         "vst1.64 {d4-d7}, [%0:128]\n\t"
+                         : "+r"(dst), "+r"(src)
+                         :
+                         : "d0", "d1", "d2", "d3", "d4", "d5", "d6", "d7",
+                           "memory");
+}
+
+#elif defined(__arm__)
+#define HAVE_LDM
+
+/* r7 (Thumb frame pointer), r9 (platform) and r10/r11 (PIC / frame
+ * pointer) are left alone so this builds in every toolchain setup */
+static inline void ldm_line_read(const char *p) {
+    __asm__ __volatile__("ldmia %0!, {r4, r5, r6, r8}\n\t"
+                         "ldmia %0!, {r4, r5, r6, r8}\n\t"
+                         "ldmia %0!, {r4, r5, r6, r8}\n\t"
+                         "ldmia %0!, {r4, r5, r6, r8}\n\t"
+                         : "+r"(p)
+                         :
+                         : "r4", "r5", "r6", "r8", "memory");
+}
+
+static inline void ldm_line_write(char *p) {
+    __asm__ __volatile__("mov r4, #0x5a\n\t"
+                         "mov r5, r4\n\t"
+                         "mov r6, r4\n\t"
+                         "mov r8, r4\n\t"
+                         "stmia %0!, {r4, r5, r6, r8}\n\t"
+                         "stmia %0!, {r4, r5, r6, r8}\n\t"
+                         "stmia %0!, {r4, r5, r6, r8}\n\t"
+                         "stmia %0!, {r4, r5, r6, r8}\n\t"
+                         : "+r"(p)
+                         :
+                         : "r4", "r5", "r6", "r8", "memory");
+}
+
+static inline void ldm_line_copy(char *dst, const char *src) {
+    __asm__ __volatile__("ldmia %1!, {r4, r5, r6, r8}\n\t"
+                         "stmia %0!, {r4, r5, r6, r8}\n\t"
+                         "ldmia %1!, {r4, r5, r6, r8}\n\t"
+                         "stmia %0!, {r4, r5, r6, r8}\n\t"
+                         "ldmia %1!, {r4, r5, r6, r8}\n\t"
+                         "stmia %0!, {r4, r5, r6, r8}\n\t"
+                         "ldmia %1!, {r4, r5, r6, r8}\n\t"
+                         "stmia %0!, {r4, r5, r6, r8}\n\t"
+                         : "+r"(dst), "+r"(src)
+                         :
+                         : "r4", "r5", "r6", "r8", "memory");
+}
+
+#elif defined(__aarch64__)
+#define HAVE_LDP_Q
+
+static inline void ldp_q_line_read(const char *p) {
+    __asm__ __volatile__("ldp q0, q1, [%0]\n\t"
+                         "ldp q2, q3, [%0, #32]\n\t"
+                         :
+                         : "r"(p)
+                         : "v0", "v1", "v2", "v3", "memory");
+}
+
+static inline void ldp_q_line_write(char *p) {
+    __asm__ __volatile__("movi v0.16b, #0x5a\n\t"
+                         "mov v1.16b, v0.16b\n\t"
+                         "stp q0, q1, [%0]\n\t"
+                         "stp q0, q1, [%0, #32]\n\t"
+                         :
+                         : "r"(p)
+                         : "v0", "v1", "memory");
+}
+
+static inline void ldp_q_line_copy(char *dst, const char *src) {
+    __asm__ __volatile__("ldp q0, q1, [%1]\n\t"
+                         "ldp q2, q3, [%1, #32]\n\t"
+                         "stp q0, q1, [%0]\n\t"
+                         "stp q2, q3, [%0, #32]\n\t"
+                         :
+                         : "r"(dst), "r"(src)
+                         : "v0", "v1", "v2", "v3", "memory");
+}
+
+#elif defined(__mips__) && !defined(__mips64)
+#define HAVE_MIPS32
+
+/* Straight-line code only, so there are no branch delay slots to care
+ * about; $t0-$t7 are caller-saved scratch registers in o32 */
+#define LW8(off)                                                               \
+    "lw $8, " #off "+0(%0)\n\t"                                                \
+    "lw $9, " #off "+4(%0)\n\t"                                                \
+    "lw $10, " #off "+8(%0)\n\t"                                               \
+    "lw $11, " #off "+12(%0)\n\t"                                              \
+    "lw $12, " #off "+16(%0)\n\t"                                              \
+    "lw $13, " #off "+20(%0)\n\t"                                              \
+    "lw $14, " #off "+24(%0)\n\t"                                              \
+    "lw $15, " #off "+28(%0)\n\t"
+#define SW8(reg, off)                                                          \
+    "sw $8, " #off "+0(" reg ")\n\t"                                           \
+    "sw $9, " #off "+4(" reg ")\n\t"                                           \
+    "sw $10, " #off "+8(" reg ")\n\t"                                          \
+    "sw $11, " #off "+12(" reg ")\n\t"                                         \
+    "sw $12, " #off "+16(" reg ")\n\t"                                         \
+    "sw $13, " #off "+20(" reg ")\n\t"                                         \
+    "sw $14, " #off "+24(" reg ")\n\t"                                         \
+    "sw $15, " #off "+28(" reg ")\n\t"
+#define T_REGS "$8", "$9", "$10", "$11", "$12", "$13", "$14", "$15"
+
+static inline void mips32_line_read(const char *p) {
+    __asm__ __volatile__(LW8(0) LW8(32) : : "r"(p) : T_REGS, "memory");
+}
+
+static inline void mips32_line_write(char *p) {
+    uint32_t v = 0x5a5a5a5a;
+    __asm__ __volatile__("sw %1, 0(%0)\n\t"
+                         "sw %1, 4(%0)\n\t"
+                         "sw %1, 8(%0)\n\t"
+                         "sw %1, 12(%0)\n\t"
+                         "sw %1, 16(%0)\n\t"
+                         "sw %1, 20(%0)\n\t"
+                         "sw %1, 24(%0)\n\t"
+                         "sw %1, 28(%0)\n\t"
+                         "sw %1, 32(%0)\n\t"
+                         "sw %1, 36(%0)\n\t"
+                         "sw %1, 40(%0)\n\t"
+                         "sw %1, 44(%0)\n\t"
+                         "sw %1, 48(%0)\n\t"
+                         "sw %1, 52(%0)\n\t"
+                         "sw %1, 56(%0)\n\t"
+                         "sw %1, 60(%0)\n\t"
+                         :
+                         : "r"(p), "r"(v)
+                         : "memory");
+}
+
+static inline void mips32_line_copy(char *dst, const char *src) {
+    __asm__ __volatile__(LW8(0) SW8("%1", 0) LW8(32) SW8("%1", 32)
+                         :
+                         : "r"(src), "r"(dst)
+                         : T_REGS, "memory");
+}
+
+#endif
+
+/* Sequential, gather (read lines by index) and scatter (write lines by
+ * index) loops around one kernel's line primitives */
+#define KERNEL_LOOPS(k)                                                        \
+    static void k##_seq_read(char *a, char *b, size_t sz) {                    \
+        (void)b;                                                               \
+        for (char *p = a, *e = a + sz; p < e; p += LINE) {                     \
+            __builtin_prefetch(p + PREFETCH_AHEAD);                            \
+            k##_line_read(p);                                                  \
+        }                                                                      \
+    }                                                                          \
+    static void k##_seq_write(char *a, char *b, size_t sz) {                   \
+        (void)b;                                                               \
+        for (char *p = a, *e = a + sz; p < e; p += LINE) {                     \
+            __builtin_prefetch(p + PREFETCH_AHEAD, 1);                         \
+            k##_line_write(p);                                                 \
+        }                                                                      \
+    }                                                                          \
+    static void k##_seq_copy(char *a, char *b, size_t sz) {                    \
+        for (size_t off = 0; off < sz; off += LINE) {                          \
+            __builtin_prefetch(a + off + PREFETCH_AHEAD);                      \
+            __builtin_prefetch(b + off + PREFETCH_AHEAD, 1);                   \
+            k##_line_copy(b + off, a + off);                                   \
+        }                                                                      \
+    }                                                                          \
+    static void k##_gather(char *a, const uint32_t *lines, size_t n) {         \
+        for (size_t i = 0; i < n; i++)                                         \
+            k##_line_read(a + (size_t)lines[i] * LINE);                        \
+    }                                                                          \
+    static void k##_scatter(char *a, const uint32_t *lines, size_t n) {        \
+        for (size_t i = 0; i < n; i++)                                         \
+            k##_line_write(a + (size_t)lines[i] * LINE);                       \
+    }
+
+#define KERNEL(k)                                                              \
+    {                                                                          \
+        #k, {k##_seq_read, k##_seq_write, k##_seq_copy}, k##_gather,           \
+            k##_scatter                                                        \
+    }
+
+typedef void (*seq_fn)(char *a, char *b, size_t sz);
+typedef void (*lines_fn)(char *a, const uint32_t *lines, size_t n);
+
+enum { OP_RD, OP_WR, OP_CP, OP_COUNT };
+static const char *const op_names[OP_COUNT] = {"read", "write", "copy"};
+
+struct kernel {
+    const char *name;
+    seq_fn seq[OP_COUNT];
+    lines_fn gather;
+    lines_fn scatter;
+};
+
+KERNEL_LOOPS(c64)
+#ifdef HAVE_NEON
+KERNEL_LOOPS(neon)
+#endif
+#ifdef HAVE_LDM
+KERNEL_LOOPS(ldm)
+#endif
+#ifdef HAVE_LDP_Q
+KERNEL_LOOPS(ldp_q)
+#endif
+#ifdef HAVE_MIPS32
+KERNEL_LOOPS(mips32)
+#endif
+
+static const struct kernel kernels[] = {
+    KERNEL(c64),
+#ifdef HAVE_NEON
+    KERNEL(neon),
+#endif
+#ifdef HAVE_LDM
+    KERNEL(ldm),
+#endif
+#ifdef HAVE_LDP_Q
+    KERNEL(ldp_q),
+#endif
+#ifdef HAVE_MIPS32
+    KERNEL(mips32),
+#endif
+};
+
+static uint32_t xorshift32(uint32_t *s) {
+    uint32_t x = *s;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *s = x;
+}
+
+static void fill_stride(uint32_t *lines, size_t n) {
+    size_t k = 0;
+    for (size_t phase = 0; phase < STRIDE_LINES; phase++)
+        for (size_t i = phase; i < n; i += STRIDE_LINES)
+            lines[k++] = i;
+}
+
+static void fill_random(uint32_t *lines, size_t n) {
+    for (size_t i = 0; i < n; i++)
+        lines[i] = i;
+    /* Fixed seed so runs are comparable */
+    uint32_t seed = 0x1234567;
+    for (size_t i = n - 1; i > 0; i--) {
+        size_t j = xorshift32(&seed) % (i + 1);
+        uint32_t t = lines[i];
+        lines[i] = lines[j];
+        lines[j] = t;
+    }
+}
+
+static double time_seq(seq_fn fn, char *a, char *b, size_t sz, int iters) {
+    double t0 = now_sec();
+    for (int i = 0; i < iters; i++)
+        fn(a, b, sz);
+    return now_sec() - t0;
+}
+
+static double time_lines(lines_fn fn, char *a, const uint32_t *lines,
+                         size_t n, int iters) {
+    double t0 = now_sec();
+    for (int i = 0; i < iters; i++)
+        fn(a, lines, n);
+    return now_sec() - t0;
+}
+
+cJSON *memkern_build_json(char *a, char *b, size_t sz, int iters, bool read,
+                          bool write, bool copy) {
+    size_t n = sz / LINE;
+    uint32_t *stride = malloc(n * sizeof(*stride));
+    uint32_t *random = malloc(n * sizeof(*random));
+    if (!stride || !random) {
+        fprintf(stderr, "membw: cannot allocate line index for kernels\n");
+        free(stride);
+        free(random);
+        return NULL;
+    }
+    fill_stride(stride, n);
+    fill_random(random, n);
+
+    const bool enabled[OP_COUNT] = {read, write, copy};
+    double bytes = (double)sz * iters;
+
+    cJSON *j_kernels = cJSON_CreateObject();
+    for (size_t k = 0; k < ARRCNT(kernels); k++) {
+        const struct kernel *kern = &kernels[k];
+        cJSON *j_kern = cJSON_CreateObject();
+        for (int op = 0; op < OP_COUNT; op++) {
+            if (!enabled[op])
+                continue;
+            cJSON *j_inner = cJSON_CreateObject();
+            double dt = time_seq(kern->seq[op], a, b, sz, iters);
+            ADD_PARAM_NUM("seq", (op == OP_CP ? 2 : 1) * bytes / dt / 1e6);
+            if (op != OP_CP) {
+                lines_fn fn = op == OP_RD ? kern->gather : kern->scatter;
+                dt = time_lines(fn, a, stride, n, iters);
+                ADD_PARAM_NUM("stride", bytes / dt / 1e6);
+                dt = time_lines(fn, a, random, n, iters);
+                ADD_PARAM_NUM("random", bytes / dt / 1e6);
+            }
+            cJSON_AddItemToObject(j_kern, op_names[op], j_inner);
+        }
+        cJSON_AddItemToObject(j_kernels, kern->name, j_kern);
+    }
+
+    free(stride);
+    free(random);
+    return j_kernels;
+}
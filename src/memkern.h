@@ -0,0 +1,16 @@
+#ifndef MEMKERN_H
+#define MEMKERN_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "cjson/cJSON.h"
+
+/* Runs every hand-written kernel built for this CPU over the two
+ * page-aligned buffers `a` and `b` (`sz` bytes each, a multiple of 64) in
+ * sequential, strided and random line order. Returns a kernel -> op ->
+ * pattern -> MB/s tree. */
+cJSON *memkern_build_json(char *a, char *b, size_t sz, int iters, bool read,
+                          bool write, bool copy);
+
+#endif /* MEMKERN_H */
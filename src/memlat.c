@@ -0,0 +1,182 @@
+/* `ipctool membw --latency` -- load-to-use latency and cache hierarchy
+ * sweep.
+ *
+ * For every working set from 4 KB up to the limit (doubling), builds one
+ * random cyclic pointer chain (Sattolo's algorithm, fixed seed so runs
+ * are comparable) with one node per 64-byte line and walks it with
+ * dependent loads. Each load has to wait for the previous one, so
+ * ns/load is the latency of whatever level the working set fits in;
+ * the hardware prefetcher can't guess the next address.
+ *
+ * Knees are picked where latency jumps by more than KNEE_RATIO over the
+ * plateau it was sitting on: the first one is the L1 size, the second
+ * L2, and the largest working set gives the DDR latency.
+ *
+ * The --tlb variant puts one node per page instead, so every load also
+ * misses the (micro-)TLB once the number of pages exceeds its reach.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "cjson/cJSON.h"
+#include "memlat.h"
+#include "tools.h"
+
+#define LINE_BYTES 64
+#define MIN_WS (4 * 1024)
+#define KNEE_RATIO 1.5
+
+static void *volatile sink_p;
+
+static uint32_t xorshift32(uint32_t *s) {
+    uint32_t x = *s;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return *s = x;
+}
+
+/* Links `n` nodes spaced `stride` bytes apart into one random cycle. */
+static bool build_chain(char *buf, size_t n, size_t stride) {
+    uint32_t *perm = malloc(n * sizeof(*perm));
+    if (!perm)
+        return false;
+    for (size_t i = 0; i < n; i++)
+        perm[i] = i;
+
+    uint32_t seed = 0x1234567;
+    for (size_t i = n - 1; i > 0; i--) {
+        size_t j = xorshift32(&seed) % i; /* Sattolo: j < i, one cycle */
+        uint32_t t = perm[i];
+        perm[i] = perm[j];
+        perm[j] = t;
+    }
+    for (size_t i = 0; i < n; i++)
+        *(void **)(buf + (size_t)perm[i] * stride) =
+            buf + (size_t)perm[(i + 1) % n] * stride;
+    free(perm);
+    return true;
+}
+
+#define CHASE8 p = *(void **)p; p = *(void **)p; p = *(void **)p;             \
+    p = *(void **)p; p = *(void **)p; p = *(void **)p; p = *(void **)p;        \
+    p = *(void **)p;
+
+static double chase_ns(char *buf, size_t nodes, uint64_t loads) {
+    void *p = buf;
+    /* One lap to warm caches/TLB for this working set */
+    for (uint64_t i = 0; i < MIN(nodes, loads) / 8 + 1; i++) {
+        CHASE8
+    }
+
+    struct timespec t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (uint64_t i = 0; i < loads / 8; i++) {
+        CHASE8
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    sink_p = p;
+
+    double dt = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+    return dt / (loads / 8 * 8);
+}
+
+// NULL if a chain could not be built
+static cJSON *sweep(char *buf, size_t max, size_t stride, uint64_t loads,
+                    double *lat, size_t *sizes, size_t *count) {
+    cJSON *arr = cJSON_CreateArray();
+    size_t n = 0;
+    for (size_t ws = MIN_WS; ws <= max; ws *= 2) {
+        size_t nodes = ws / stride;
+        if (nodes < 2)
+            continue;
+        if (!build_chain(buf, nodes, stride)) {
+            fprintf(stderr, "membw: out of memory for a %zu KB chain\n",
+                    ws / 1024);
+            cJSON_Delete(arr);
+            return NULL;
+        }
+        lat[n] = chase_ns(buf, nodes, loads);
+        sizes[n] = ws;
+
+        cJSON *j_inner = cJSON_CreateObject();
+        ADD_PARAM_NUM("kb", ws / 1024);
+        ADD_PARAM_NUM("ns_per_load", lat[n]);
+        cJSON_AddItemToArray(arr, j_inner);
+        n++;
+    }
+    *count = n;
+    return arr;
+}
+
+static cJSON *find_knees(const double *lat, const size_t *sizes, size_t n) {
+    cJSON *j_inner = cJSON_CreateObject();
+    const char *names[] = {"l1_kb", "l2_kb"};
+    size_t found = 0;
+    double plateau = lat[0];
+    for (size_t i = 1; i < n && found < ARRCNT(names); i++) {
+        if (lat[i] > plateau * KNEE_RATIO) {
+            ADD_PARAM_NUM(names[found], sizes[i - 1] / 1024);
+            found++;
+            plateau = lat[i];
+        } else if (lat[i] < plateau) {
+            plateau = lat[i];
+        }
+    }
+    if (n)
+        ADD_PARAM_NUM("ddr_ns", lat[n - 1]);
+    return j_inner;
+}
+
+cJSON *memlat_build_json(size_t max_mb, bool tlb) {
+    size_t max = max_mb * 1024UL * 1024UL;
+    long page = sysconf(_SC_PAGESIZE);
+
+    char *buf = mmap(NULL, max, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buf == MAP_FAILED) {
+        fprintf(stderr, "membw: cannot map %zu MB for latency sweep\n",
+                max_mb);
+        return NULL;
+    }
+    memset(buf, 0, max);
+
+    /* Enough loads that the timer resolution and the warm-up lap don't
+     * matter, but bounded so a 100+ ns DDR walk stays well under 1 s */
+    uint64_t loads = 1 << 21;
+    double lat[64];
+    size_t sizes[64], n;
+
+    cJSON *j_inner = NULL;
+    cJSON *lines = sweep(buf, max, LINE_BYTES, loads, lat, sizes, &n);
+    if (lines) {
+        j_inner = cJSON_CreateObject();
+        ADD_PARAM_NUM("line_bytes", LINE_BYTES);
+        ADD_PARAM_NUM("loads", (double)loads);
+        cJSON_AddItemToObject(j_inner, "sizes", lines);
+        cJSON_AddItemToObject(j_inner, "knees", find_knees(lat, sizes, n));
+    }
+
+    if (j_inner && tlb) {
+        cJSON *pages = sweep(buf, max, page, loads, lat, sizes, &n);
+        if (pages) {
+            cJSON *j_tlb = cJSON_CreateObject();
+            cJSON_AddItemToObject(j_tlb, "page_bytes",
+                                  cJSON_CreateNumber(page));
+            cJSON_AddItemToObject(j_tlb, "sizes", pages);
+            cJSON_AddItemToObject(j_inner, "tlb", j_tlb);
+        } else {
+            cJSON_Delete(j_inner);
+            j_inner = NULL;
+        }
+    }
+
+    munmap(buf, max);
+    return j_inner;
+}
@@ -0,0 +1,13 @@
+#ifndef MEMLAT_H
+#define MEMLAT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "cjson/cJSON.h"
+
+/* Pointer-chasing latency sweep from 4 KB to max_mb, optionally with a
+ * page-strided TLB variant. Returns NULL if the buffer can't be mapped. */
+cJSON *memlat_build_json(size_t max_mb, bool tlb);
+
+#endif /* MEMLAT_H */
@@ -0,0 +1,208 @@
+/* `ipctool membw --monitor` -- bandwidth left over while the streamer runs.
+ *
+ * Instead of one saturating burst, copies a small slice (PROBE_BYTES)
+ * between two DDR rings a few times per second and turns each copy into
+ * one MB/s sample. The slice walks through rings several times larger
+ * than L2, so every probe misses the caches and competes with encoder /
+ * ISP DMA for the DDR controller: the result is the bandwidth one core
+ * can still get right now.
+ *
+ * Probes are rate limited twice: at most PROBES_PER_SEC, and never more
+ * than DUTY of wall time including the probe itself, so a slow probe
+ * (heavily loaded DDR) stretches the gap instead of adding load. Together
+ * with the temperature read once per interval this stays around 1% CPU;
+ * the measured figure is reported as cpu_pct.
+ *
+ * Samples go into fixed-width histograms (one per interval, one for the
+ * whole run), from which p50 / p95 / p99 are read off.
+ */
+
+#include <math.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+
+#include "cjson/cJSON.h"
+#include "hwinfo.h"
+#include "memmon.h"
+#include "tools.h"
+
+#define PROBE_BYTES (256 * 1024)
+#define PROBES_PER_SEC 20
+#define DUTY 0.01
+#define BUCKET_MBPS 10
+#define BUCKETS 4096 // up to 40 GB/s, the rest lands in the last bucket
+
+struct histogram {
+    uint32_t count[BUCKETS];
+    uint32_t total;
+    double min, max;
+};
+
+static volatile sig_atomic_t stop;
+
+static void on_signal(int sig) {
+    (void)sig;
+    stop = 1;
+}
+
+static double clock_sec(clockid_t clk) {
+    struct timespec ts;
+    clock_gettime(clk, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void hist_add(struct histogram *h, double mbps) {
+    size_t b = mbps / BUCKET_MBPS;
+    h->count[MIN(b, (size_t)BUCKETS - 1)]++;
+    if (!h->total || mbps < h->min)
+        h->min = mbps;
+    if (!h->total || mbps > h->max)
+        h->max = mbps;
+    h->total++;
+}
+
+static void hist_merge(struct histogram *into, const struct histogram *h) {
+    if (!h->total)
+        return;
+    for (size_t i = 0; i < BUCKETS; i++)
+        into->count[i] += h->count[i];
+    if (!into->total || h->min < into->min)
+        into->min = h->min;
+    if (!into->total || h->max > into->max)
+        into->max = h->max;
+    into->total += h->total;
+}
+
+// Upper edge of the bucket holding the p-th percentile sample
+static double hist_pct(const struct histogram *h, double p) {
+    uint32_t want = (uint32_t)ceil(h->total * p / 100.0), seen = 0;
+    for (size_t b = 0; b < BUCKETS; b++) {
+        seen += h->count[b];
+        if (seen >= want && seen)
+            return MIN((b + 1) * (double)BUCKET_MBPS, h->max);
+    }
+    return h->max;
+}
+
+static cJSON *hist_json(cJSON *j_inner, const struct histogram *h) {
+    ADD_PARAM_NUM("samples", h->total);
+    if (!h->total)
+        return j_inner;
+    ADD_PARAM_NUM("min", h->min);
+    ADD_PARAM_NUM("p50", hist_pct(h, 50));
+    ADD_PARAM_NUM("p95", hist_pct(h, 95));
+    ADD_PARAM_NUM("p99", hist_pct(h, 99));
+    ADD_PARAM_NUM("max", h->max);
+    return j_inner;
+}
+
+static void sleep_until(double t) {
+    double ip;
+    double frac = modf(t, &ip);
+    struct timespec ts = {.tv_sec = (time_t)ip, .tv_nsec = frac * 1e9};
+    while (!stop && clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts,
+                                    NULL) != 0)
+        ;
+}
+
+cJSON *memmon_build_json(size_t mb, unsigned interval_s, unsigned duration_s) {
+    size_t sz = mb * 1024UL * 1024UL;
+    char *a = mmap(NULL, sz, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    char *b = mmap(NULL, sz, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (a == MAP_FAILED || b == MAP_FAILED) {
+        fprintf(stderr, "membw: cannot map 2 x %zu MB for monitor\n", mb);
+        if (a != MAP_FAILED)
+            munmap(a, sz);
+        if (b != MAP_FAILED)
+            munmap(b, sz);
+        return NULL;
+    }
+    memset(a, 1, sz);
+    memset(b, 2, sz);
+
+    static struct histogram run, cur;
+    memset(&run, 0, sizeof(run));
+    memset(&cur, 0, sizeof(cur));
+
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+
+    cJSON *intervals = cJSON_CreateArray();
+    double t0 = clock_sec(CLOCK_MONOTONIC);
+    double cpu0 = clock_sec(CLOCK_PROCESS_CPUTIME_ID);
+    double end = duration_s ? t0 + duration_s : INFINITY;
+    double next_interval = t0 + interval_s;
+    double next_probe = t0;
+    size_t off = 0;
+    float tmax = NAN;
+
+    while (!stop) {
+        sleep_until(next_probe);
+        if (stop)
+            break;
+
+        double p0 = clock_sec(CLOCK_MONOTONIC);
+        memcpy(b + off, a + off, PROBE_BYTES);
+        double p1 = clock_sec(CLOCK_MONOTONIC);
+        off = (off + PROBE_BYTES) % sz;
+        /* memcpy moves 2x bytes (one read, one write) */
+        hist_add(&cur, 2.0 * PROBE_BYTES / (p1 - p0) / 1e6);
+
+        next_probe = p0 + MAX(1.0 / PROBES_PER_SEC, (p1 - p0) / DUTY);
+
+        if (p1 < next_interval && p1 < end)
+            continue;
+
+        float temp = gethwtemp();
+        cJSON *j_inner = cJSON_CreateObject();
+        ADD_PARAM_NUM("t", round(p1 - t0));
+        hist_json(j_inner, &cur);
+        if (!isnan(temp)) {
+            ADD_PARAM_NUM("temp", temp);
+            if (isnan(tmax) || temp > tmax)
+                tmax = temp;
+        }
+        cJSON_AddItemToArray(intervals, j_inner);
+        fprintf(stderr,
+                "[%6.0f s] p50 %6.0f  p95 %6.0f  p99 %6.0f MB/s (%u probes)",
+                p1 - t0, hist_pct(&cur, 50), hist_pct(&cur, 95),
+                hist_pct(&cur, 99), cur.total);
+        if (!isnan(temp))
+            fprintf(stderr, ", %.1f C", temp);
+        fputc('\n', stderr);
+
+        hist_merge(&run, &cur);
+        memset(&cur, 0, sizeof(cur));
+
+        if (p1 >= end)
+            break;
+        next_interval += interval_s;
+    }
+    // Probes of an interval cut short by Ctrl-C still count for the run
+    hist_merge(&run, &cur);
+
+    double wall = clock_sec(CLOCK_MONOTONIC) - t0;
+    double cpu = clock_sec(CLOCK_PROCESS_CPUTIME_ID) - cpu0;
+
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM_NUM("probe_kb", PROBE_BYTES / 1024);
+    ADD_PARAM_NUM("ring_mb", (double)mb);
+    ADD_PARAM_NUM("interval_s", interval_s);
+    ADD_PARAM_NUM("duration_s", wall);
+    ADD_PARAM_NUM("cpu_pct", wall > 0 ? cpu / wall * 100 : 0);
+    if (!isnan(tmax))
+        ADD_PARAM_NUM("temp_max", tmax);
+    cJSON_AddItemToObject(j_inner, "mb_per_sec",
+                          hist_json(cJSON_CreateObject(), &run));
+    cJSON_AddItemToObject(j_inner, "intervals", intervals);
+
+    munmap(a, sz);
+    munmap(b, sz);
+    return j_inner;
+}
@@ -0,0 +1,14 @@
+#ifndef MEMMON_H
+#define MEMMON_H
+
+#include <stddef.h>
+
+#include "cjson/cJSON.h"
+
+/* Low-duty bandwidth monitor: probes a `mb` MB ring every now and then
+ * for `duration_s` seconds (0 = until SIGINT/SIGTERM) and returns the
+ * per-interval and whole-run percentiles. NULL if buffers can't be
+ * mapped. */
+cJSON *memmon_build_json(size_t mb, unsigned interval_s, unsigned duration_s);
+
+#endif /* MEMMON_H */
@@ -102,6 +102,39 @@ static void parse_partitions(mpoint_t mpoints[MAX_MPOINTS]) {
     }
 }
 
+bool mtd_in_use(int num, const char *name) {
+    if (num < MAX_MPOINTS) {
+        mpoint_t mpoints[MAX_MPOINTS];
+        memset(mpoints, 0, sizeof(mpoints));
+        parse_partitions(mpoints);
+        if (*mpoints[num].path)
+            return true;
+    }
+    if (find_ubi_for_mtd(num) >= 0)
+        return true;
+
+    // parse_partitions() only knows mtdblock0..9, and JFFS2 also mounts
+    // straight from "mtdN" / "mtd:NAME"
+    FILE *f = fopen("/proc/mounts", "r");
+    if (!f)
+        return true;
+    char blk[32], bynum[16], byname[80], line[256];
+    snprintf(blk, sizeof(blk), "/dev/mtdblock%d", num);
+    snprintf(bynum, sizeof(bynum), "mtd%d", num);
+    snprintf(byname, sizeof(byname), "mtd:%s", name);
+    bool found = false;
+    while (!found && fgets(line, sizeof(line), f)) {
+        char dev[128], fs[32];
+        if (sscanf(line, "%127s %*s %31s", dev, fs) != 2)
+            continue;
+        found = !strcmp(dev, blk) ||
+                (!strcmp(fs, "jffs2") &&
+                 (!strcmp(dev, bynum) || !strcmp(dev, byname)));
+    }
+    fclose(f);
+    return found;
+}
+
 char *open_mtdblock(int i, int *fd, uint32_t size, int flags) {
     char filename[PATH_MAX];
 
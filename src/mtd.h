@@ -9,6 +9,8 @@ typedef bool (*cb_mtd)(int i, const char *name, struct mtd_info_user *mtd,
 
 cJSON *get_mtd_info();
 char *open_mtdblock(int i, int *fd, uint32_t size, int flags);
+// root filesystem, mounted, or attached to UBI: not to be erased
+bool mtd_in_use(int num, const char *name);
 void enum_mtd_info(void *ctx, cb_mtd cb);
 bool mtd_write(int mtd, uint32_t offset, uint32_t erasesize, const char *data,
                size_t size);
@@ -0,0 +1,552 @@
+/* `ipctool netbench` -- iperf-like TCP bulk throughput test.
+ *
+ * One side runs `netbench --server`, the other `netbench --client HOST`.
+ * The client sends a small header (direction, duration, write size,
+ * zero-copy) and then one side streams for --time seconds while the other
+ * drains. Both ends print per-interval throughput; the sender also reads
+ * RTT, RTT variance and retransmits from TCP_INFO every interval, since
+ * those explain most Wi-Fi and bad-cable results. When the sender is
+ * done it half-closes and the receiver answers with the byte count it
+ * got, so the sender's summary has both sides of the story.
+ *
+ * --zerocopy makes the sender use sendfile() from a page-cache backed
+ * file in /tmp instead of send() from a user buffer: the kernel copies
+ * straight from the page cache into the socket, which is what a streamer
+ * serving recorded files would do, and works on the 3.x / 4.x kernels
+ * most cameras run (MSG_ZEROCOPY needs 4.14+).
+ */
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <getopt.h>
+#include <math.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/sendfile.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "cjson/cJSON.h"
+#include "cjson/cYAML.h"
+#include "dns.h"
+#include "http.h"
+#include "netbench.h"
+#include "tools.h"
+
+#define NETBENCH_PORT 5201
+#define NETBENCH_MAGIC 0x49504e42 // "IPNB"
+#define CONNECT_TIMEOUT 3000      // milliseconds
+#define DEFAULT_LEN (128 * 1024)
+#define MAX_LEN (16 * 1024 * 1024)
+#define RECV_GRACE 10 // seconds past --time before giving up on a sender
+
+#define FLAG_REVERSE 1 // server sends
+#define FLAG_ZEROCOPY 2
+
+struct hdr {
+    uint32_t magic;
+    uint32_t flags;
+    uint32_t duration;
+    uint32_t len;
+};
+
+struct stream {
+    int fd;
+    bool sender;
+    bool zerocopy;
+    size_t len;
+    unsigned duration, interval;
+
+    uint64_t bytes, peer_bytes;
+    double secs;
+    cJSON *intervals;
+};
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static bool get_tcp_info(int fd, struct tcp_info *ti) {
+    socklen_t len = sizeof(*ti);
+    memset(ti, 0, sizeof(*ti));
+    return getsockopt(fd, IPPROTO_TCP, TCP_INFO, ti, &len) == 0;
+}
+
+static bool send_all(int fd, const void *buf, size_t len) {
+    const char *p = buf;
+    while (len) {
+        ssize_t n = send(fd, p, len, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+static bool recv_all(int fd, void *buf, size_t len) {
+    char *p = buf;
+    while (len) {
+        ssize_t n = recv(fd, p, len, 0);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        p += n;
+        len -= n;
+    }
+    return true;
+}
+
+// Page-cache backed source for sendfile(), unlinked right away
+static int zerocopy_source(const char *buf, size_t len) {
+    char path[] = "/tmp/netbenchXXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0)
+        return -1;
+    unlink(path);
+    if (write(fd, buf, len) != (ssize_t)len) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void add_interval(struct stream *s, double t, double dt,
+                         uint64_t bytes, uint32_t *last_retrans) {
+    double mbit = bytes * 8 / dt / 1e6;
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM_NUM("t", round(t * 10) / 10);
+    ADD_PARAM_NUM("bytes", bytes);
+    ADD_PARAM_NUM("mbit_per_sec", round(mbit * 10) / 10);
+    fprintf(stderr, "[%6.1f s] %8.1f Mbit/s", t, mbit);
+
+    struct tcp_info ti;
+    if (s->sender && get_tcp_info(s->fd, &ti)) {
+        uint32_t retrans = ti.tcpi_total_retrans - *last_retrans;
+        *last_retrans = ti.tcpi_total_retrans;
+        ADD_PARAM_NUM("rtt_ms", ti.tcpi_rtt / 1000.0);
+        ADD_PARAM_NUM("retrans", retrans);
+        ADD_PARAM_NUM("cwnd", ti.tcpi_snd_cwnd);
+        fprintf(stderr, "  rtt %6.2f ms  retr %4u  cwnd %4u",
+                ti.tcpi_rtt / 1000.0, retrans, ti.tcpi_snd_cwnd);
+    }
+    fputc('\n', stderr);
+    cJSON_AddItemToArray(s->intervals, j_inner);
+}
+
+static bool run_stream(struct stream *s) {
+    char *buf = malloc(s->len);
+    if (!buf)
+        return false;
+    for (size_t i = 0; i < s->len; i++)
+        buf[i] = i * 7;
+
+    int zfd = -1;
+    if (s->sender && s->zerocopy) {
+        zfd = zerocopy_source(buf, s->len);
+        if (zfd < 0) {
+            fprintf(stderr, "netbench: no /tmp file for sendfile, using "
+                            "send()\n");
+            s->zerocopy = false;
+        }
+    }
+    if (!s->sender) {
+        // Wake up every second so a stalled sender shows as empty intervals
+        struct timeval tv = {.tv_sec = 1};
+        setsockopt(s->fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+    }
+
+    s->intervals = cJSON_CreateArray();
+    double t0 = now_sec(), last = t0, now = t0;
+    double end = t0 + s->duration;
+    uint64_t last_bytes = 0;
+    uint32_t last_retrans = 0;
+    bool ok = true;
+
+    for (;;) {
+        ssize_t n;
+        if (s->sender) {
+            if (now >= end)
+                break;
+            if (zfd >= 0) {
+                off_t off = 0;
+                n = sendfile(s->fd, zfd, &off, s->len);
+            } else
+                n = send(s->fd, buf, s->len, MSG_NOSIGNAL);
+        } else
+            n = recv(s->fd, buf, s->len, 0);
+
+        if (n < 0 && (errno == EINTR || errno == EAGAIN))
+            n = 0;
+        else if (n <= 0) {
+            // receiver: 0 is the sender's half-close
+            ok = !s->sender && n == 0;
+            break;
+        }
+        s->bytes += n;
+
+        now = now_sec();
+        if (now - last >= s->interval) {
+            add_interval(s, now - t0, now - last, s->bytes - last_bytes,
+                         &last_retrans);
+            last = now;
+            last_bytes = s->bytes;
+        }
+        if (!s->sender && now > end + RECV_GRACE) {
+            fprintf(stderr, "netbench: sender went silent\n");
+            ok = false;
+            break;
+        }
+    }
+    s->secs = now_sec() - t0;
+    if (now - last >= s->interval / 10.0 && s->bytes > last_bytes)
+        add_interval(s, now - t0, now - last, s->bytes - last_bytes,
+                     &last_retrans);
+
+    uint32_t total[2];
+    if (s->sender) {
+        // Half-close and wait for the receiver's byte count
+        shutdown(s->fd, SHUT_WR);
+        struct timeval tv = {.tv_sec = RECV_GRACE};
+        setsockopt(s->fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+        if (recv_all(s->fd, total, sizeof(total)))
+            s->peer_bytes = (uint64_t)ntohl(total[0]) << 32 | ntohl(total[1]);
+    } else if (ok) {
+        total[0] = htonl(s->bytes >> 32);
+        total[1] = htonl(s->bytes & 0xffffffff);
+        send_all(s->fd, total, sizeof(total));
+    }
+
+    if (zfd >= 0)
+        close(zfd);
+    free(buf);
+    return ok;
+}
+
+static void set_bufs(int fd, int sndbuf, int rcvbuf) {
+    if (sndbuf)
+        setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+    if (rcvbuf)
+        setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+}
+
+static cJSON *stream_json(struct stream *s, const char *role,
+                          const struct sockaddr_in *peer) {
+    cJSON *j_root = cJSON_CreateObject();
+    cJSON *j_inner = j_root;
+    char addr[INET_ADDRSTRLEN];
+    inet_ntop(AF_INET, &peer->sin_addr, addr, sizeof(addr));
+    ADD_PARAM("role", role);
+    ADD_PARAM_FMT("peer", "%s:%d", addr, ntohs(peer->sin_port));
+    ADD_PARAM("direction", s->sender ? "send" : "receive");
+    ADD_PARAM_NUM("len", s->len);
+    if (s->sender)
+        cJSON_AddItemToObject(j_root, "zerocopy",
+                              cJSON_CreateBool(s->zerocopy));
+
+    int sndbuf = 0, rcvbuf = 0;
+    socklen_t optlen = sizeof(int);
+    getsockopt(s->fd, SOL_SOCKET, SO_SNDBUF, &sndbuf, &optlen);
+    optlen = sizeof(int);
+    getsockopt(s->fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, &optlen);
+    ADD_PARAM_NUM("sndbuf", sndbuf);
+    ADD_PARAM_NUM("rcvbuf", rcvbuf);
+    cJSON_AddItemToObject(j_root, "intervals", s->intervals);
+
+    j_inner = cJSON_CreateObject();
+    ADD_PARAM_NUM("seconds", round(s->secs * 100) / 100);
+    ADD_PARAM_NUM("bytes", s->bytes);
+    double mbit = s->secs > 0 ? s->bytes * 8 / s->secs / 1e6 : 0;
+    ADD_PARAM_NUM("mbit_per_sec", round(mbit * 10) / 10);
+    if (s->sender && s->peer_bytes)
+        ADD_PARAM_NUM("peer_bytes", s->peer_bytes);
+
+    struct tcp_info ti;
+    if (get_tcp_info(s->fd, &ti)) {
+        ADD_PARAM_NUM("rtt_ms", ti.tcpi_rtt / 1000.0);
+        ADD_PARAM_NUM("rttvar_ms", ti.tcpi_rttvar / 1000.0);
+        ADD_PARAM_NUM("retrans", ti.tcpi_total_retrans);
+        ADD_PARAM_NUM("mss", ti.tcpi_snd_mss);
+    }
+    cJSON_AddItemToObject(j_root, "summary", j_inner);
+
+    fprintf(stderr, "%s %.1f Mbit/s over %.1f s", s->sender ? "sent" : "recv",
+            mbit, s->secs);
+    if (s->sender && s->peer_bytes)
+        fprintf(stderr, ", peer got %.1f MB", s->peer_bytes / 1e6);
+    fputc('\n', stderr);
+    return j_root;
+}
+
+static void print_result(cJSON *j_root, bool want_json) {
+    cJSON *root = cJSON_CreateObject();
+    cJSON_AddItemToObject(root, "netbench", j_root);
+    char *out = want_json ? cJSON_Print(root) : cYAML_Print(root);
+    if (out) {
+        printf("%s", out);
+        if (want_json)
+            printf("\n");
+        free(out);
+    }
+    fflush(stdout);
+    cJSON_Delete(root);
+}
+
+static int run_server(int port, unsigned interval, int sndbuf, int rcvbuf,
+                      bool once, bool want_json) {
+    int ls = socket(AF_INET, SOCK_STREAM, 0);
+    if (ls < 0) {
+        perror("socket");
+        return EXIT_FAILURE;
+    }
+    int one = 1;
+    setsockopt(ls, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    set_bufs(ls, sndbuf, rcvbuf);
+
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_port = htons(port);
+    if (bind(ls, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+        listen(ls, 1) < 0) {
+        perror("netbench: bind");
+        close(ls);
+        return EXIT_FAILURE;
+    }
+    fprintf(stderr, "netbench: listening on port %d\n", port);
+
+    int ret = EXIT_SUCCESS;
+    do {
+        struct sockaddr_in peer;
+        socklen_t plen = sizeof(peer);
+        int fd = accept(ls, (struct sockaddr *)&peer, &plen);
+        if (fd < 0) {
+            if (errno == EINTR)
+                continue;
+            perror("netbench: accept");
+            ret = EXIT_FAILURE;
+            break;
+        }
+
+        struct timeval tv = {.tv_sec = CONNECT_TIMEOUT / 1000};
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+        struct hdr h;
+        if (!recv_all(fd, &h, sizeof(h)) || ntohl(h.magic) != NETBENCH_MAGIC ||
+            !ntohl(h.len) || ntohl(h.len) > MAX_LEN) {
+            fprintf(stderr, "netbench: bad request, dropping client\n");
+            close(fd);
+            ret = EXIT_FAILURE;
+            continue;
+        }
+
+        uint32_t flags = ntohl(h.flags);
+        struct stream s = {
+            .fd = fd,
+            .sender = flags & FLAG_REVERSE,
+            .zerocopy = flags & FLAG_ZEROCOPY,
+            .len = ntohl(h.len),
+            .duration = ntohl(h.duration),
+            .interval = interval,
+        };
+        bool ok = run_stream(&s);
+        print_result(stream_json(&s, "server", &peer), want_json);
+        close(fd);
+        ret = ok ? EXIT_SUCCESS : EXIT_FAILURE;
+    } while (!once);
+
+    close(ls);
+    return ret;
+}
+
+static bool resolve(const char *host, struct in_addr *out) {
+    if (inet_pton(AF_INET, host, out) == 1)
+        return true;
+
+    nservers_t ns;
+    ns.len = 0;
+    a_records_t srv;
+    if (!parse_resolv_conf(&ns) || !resolv_name(&ns, host, &srv) ||
+        !srv.len)
+        return false;
+    memcpy(out, &srv.ipv4_addr[0], sizeof(*out));
+    return true;
+}
+
+static int run_client(const char *host, int port, struct stream *s,
+                      bool reverse, int sndbuf, int rcvbuf, bool want_json) {
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (!resolve(host, &addr.sin_addr)) {
+        fprintf(stderr, "netbench: cannot resolve %s\n", host);
+        return EXIT_FAILURE;
+    }
+
+    s->fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (s->fd < 0) {
+        perror("socket");
+        return EXIT_FAILURE;
+    }
+    // Before connect(), so the window scale is negotiated for them
+    set_bufs(s->fd, sndbuf, rcvbuf);
+    if (connect_with_timeout(s->fd, (struct sockaddr *)&addr, sizeof(addr),
+                             CONNECT_TIMEOUT) < 0) {
+        fprintf(stderr, "netbench: cannot connect to %s:%d: %s\n", host,
+                port, strerror(errno));
+        close(s->fd);
+        return EXIT_FAILURE;
+    }
+
+    struct hdr h = {
+        .magic = htonl(NETBENCH_MAGIC),
+        .flags = htonl((reverse ? FLAG_REVERSE : 0) |
+                       (s->zerocopy ? FLAG_ZEROCOPY : 0)),
+        .duration = htonl(s->duration),
+        .len = htonl(s->len),
+    };
+    if (!send_all(s->fd, &h, sizeof(h))) {
+        fprintf(stderr, "netbench: server closed the connection\n");
+        close(s->fd);
+        return EXIT_FAILURE;
+    }
+
+    s->sender = !reverse;
+    bool ok = run_stream(s);
+    print_result(stream_json(s, "client", &addr), want_json);
+    close(s->fd);
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static void print_netbench_usage(void) {
+    printf("Usage: ipctool netbench --server [--port P] [--once] "
+           "[--json]\n"
+           "       ipctool netbench --client HOST [--port P] [--time S]\n"
+           "                        [--interval S] [--len BYTES] "
+           "[--reverse]\n"
+           "                        [--zerocopy] [--sndbuf B] [--rcvbuf B] "
+           "[--json]\n"
+           "\n"
+           "TCP bulk throughput between two hosts running ipctool, with\n"
+           "per-interval rate, RTT and retransmits from TCP_INFO.\n"
+           "\n"
+           "  --server       wait for clients (one at a time)\n"
+           "  --once         server: exit after the first client\n"
+           "  --client HOST  connect to a netbench server\n"
+           "  --port P       TCP port (default: %d)\n"
+           "  --time S       test length (default: 10)\n"
+           "  --interval S   report interval (default: 1)\n"
+           "  --len BYTES    size of each send / recv (default: %d)\n"
+           "  --reverse      server sends, client receives\n"
+           "  --zerocopy     sender uses sendfile() instead of send()\n"
+           "  --sndbuf B     SO_SNDBUF for this end\n"
+           "  --rcvbuf B     SO_RCVBUF for this end\n"
+           "  --json         machine-readable JSON instead of YAML\n",
+           NETBENCH_PORT, DEFAULT_LEN);
+}
+
+int netbench_cmd(int argc, char **argv) {
+    bool server = false, once = false, reverse = false, want_json = false;
+    const char *host = NULL;
+    int port = NETBENCH_PORT, sndbuf = 0, rcvbuf = 0;
+    struct stream s = {
+        .len = DEFAULT_LEN,
+        .duration = 10,
+        .interval = 1,
+    };
+
+    const struct option long_options[] = {
+        {"server", no_argument, NULL, 's'},
+        {"once", no_argument, NULL, '1'},
+        {"client", required_argument, NULL, 'c'},
+        {"port", required_argument, NULL, 'p'},
+        {"time", required_argument, NULL, 't'},
+        {"interval", required_argument, NULL, 'i'},
+        {"len", required_argument, NULL, 'l'},
+        {"reverse", no_argument, NULL, 'R'},
+        {"zerocopy", no_argument, NULL, 'Z'},
+        {"sndbuf", required_argument, NULL, 'S'},
+        {"rcvbuf", required_argument, NULL, 'r'},
+        {"json", no_argument, NULL, 'j'},
+        {"help", no_argument, NULL, 'h'},
+        {NULL, 0, NULL, 0},
+    };
+    int opt;
+    optind = 1;
+    while ((opt = getopt_long(argc, argv, "s1c:p:t:i:l:RZS:r:jh",
+                              long_options, NULL)) != -1) {
+        switch (opt) {
+        case 's':
+            server = true;
+            break;
+        case '1':
+            once = true;
+            break;
+        case 'c':
+            host = optarg;
+            break;
+        case 'p':
+            port = atoi(optarg);
+            break;
+        case 't':
+            s.duration = strtoul(optarg, NULL, 10);
+            break;
+        case 'i':
+            s.interval = strtoul(optarg, NULL, 10);
+            break;
+        case 'l':
+            s.len = strtoul(optarg, NULL, 0);
+            break;
+        case 'R':
+            reverse = true;
+            break;
+        case 'Z':
+            s.zerocopy = true;
+            break;
+        case 'S':
+            sndbuf = strtoul(optarg, NULL, 0);
+            break;
+        case 'r':
+            rcvbuf = strtoul(optarg, NULL, 0);
+            break;
+        case 'j':
+            want_json = true;
+            break;
+        case 'h':
+            print_netbench_usage();
+            return EXIT_SUCCESS;
+        default:
+            print_netbench_usage();
+            return EXIT_FAILURE;
+        }
+    }
+    if (server == !!host) {
+        print_netbench_usage();
+        return EXIT_FAILURE;
+    }
+    if (port <= 0 || port > 65535 || !s.duration || !s.interval ||
+        !s.len || s.len > MAX_LEN) {
+        fprintf(stderr, "netbench: need a valid --port, --time, --interval "
+                        "and 1 <= --len <= %d\n",
+                MAX_LEN);
+        return EXIT_FAILURE;
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+    if (server)
+        return run_server(port, s.interval, sndbuf, rcvbuf, once, want_json);
+    return run_client(host, port, &s, reverse, sndbuf, rcvbuf, want_json);
+}
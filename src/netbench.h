@@ -0,0 +1,6 @@
+#ifndef NETBENCH_H
+#define NETBENCH_H
+
+int netbench_cmd(int argc, char **argv);
+
+#endif /* NETBENCH_H */
@@ -0,0 +1,50 @@
+#ifndef PINMUX_H
+#define PINMUX_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef const struct {
+    uint32_t address;
+    const char *funcs[];
+} muxctrl_reg_t;
+
+#define MUXCTRL(name, addr, ...)                                               \
+    static muxctrl_reg_t name = {addr, {__VA_ARGS__, 0}};
+
+// One function of one pad: MUXCTRL register and the value selecting it
+typedef struct {
+    const muxctrl_reg_t *reg;
+    uint32_t address;
+    int func;
+} pinmux_func_t;
+
+// Pad that has a HiSilicon-style "GPIOg_n" function
+typedef struct {
+    const muxctrl_reg_t *reg;
+    uint32_t address;
+    int func;
+    uint8_t group;
+    uint8_t num;
+} pinmux_gpio_t;
+
+// MUXCTRL table of the detected chip in datasheet order, NULL if unknown
+const muxctrl_reg_t **pinmux_table();
+
+/* Index over pinmux_table(), built once per process on first use:
+ * address-sorted register view plus a hash from every pad/function name
+ * to (register, function number). */
+size_t pinmux_sorted(const muxctrl_reg_t *const **regs);
+const muxctrl_reg_t *pinmux_by_address(uint32_t address);
+// fills up to `max` pads offering `name`, returns total number of matches
+size_t pinmux_lookup(const char *name, pinmux_func_t *out, size_t max);
+// function number of `name` on register `reg`, -1 if it doesn't offer it
+int pinmux_func_on(const muxctrl_reg_t *reg, const char *name);
+size_t pinmux_gpio_pads(const pinmux_gpio_t **pads);
+const pinmux_gpio_t *pinmux_gpio(int group, int num);
+
+// ipchw.h entry point: first pad offering `name`
+bool getpinmux(const char *name, uint32_t *reg, int *func);
+
+#endif /* PINMUX_H */
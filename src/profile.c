@@ -0,0 +1,165 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+
+#include "cjson/cJSON.h"
+#include "hal/common.h"
+#include "profile.h"
+#include "tools.h"
+
+bool prof_enabled;
+uint64_t prof_counters[PROF_COUNTERS];
+
+static const char *const counter_names[PROF_COUNTERS] = {
+    [PROF_MEM_REG] = "mem_reg",
+    [PROF_I2C] = "i2c",
+    [PROF_SPI] = "spi",
+    [PROF_IOCTL] = "ioctl",
+    [PROF_READ_BYTES] = "read_bytes",
+    [PROF_REGEX] = "regex",
+};
+
+static cJSON *report;
+static struct prof_scope command_scope;
+static const char *report_path;
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static long peak_rss_kb(void) {
+    struct rusage ru;
+    if (getrusage(RUSAGE_SELF, &ru))
+        return 0;
+    return ru.ru_maxrss;
+}
+
+// Wall time and non-zero counter deltas since `s` began
+static void add_scope_stats(cJSON *j_inner, const struct prof_scope *s) {
+    ADD_PARAM_NUM("ms", round((now_ns() - s->t0_ns) / 1e4) / 100);
+    for (int i = 0; i < PROF_COUNTERS; i++) {
+        uint64_t d = prof_counters[i] - s->c0[i];
+        if (d)
+            ADD_PARAM_NUM(counter_names[i], d);
+    }
+}
+
+void prof_begin(struct prof_scope *s, const char *group, const char *name) {
+    if (!prof_enabled) {
+        s->group = NULL;
+        return;
+    }
+    s->group = group;
+    snprintf(s->name, sizeof(s->name), "%s", name);
+    memcpy(s->c0, prof_counters, sizeof(s->c0));
+    s->rss0_kb = peak_rss_kb();
+    s->t0_ns = now_ns();
+}
+
+void prof_end(struct prof_scope *s) {
+    if (!prof_enabled || !s->group)
+        return;
+
+    cJSON *arr = cJSON_GetObjectItem(report, s->group);
+    if (!arr) {
+        arr = cJSON_CreateArray();
+        cJSON_AddItemToObject(report, s->group, arr);
+    }
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM("name", s->name);
+    add_scope_stats(j_inner, s);
+    long rss = peak_rss_kb();
+    if (rss > s->rss0_kb)
+        ADD_PARAM_NUM("rss_growth_kb", rss - s->rss0_kb);
+    cJSON_AddItemToArray(arr, j_inner);
+    s->group = NULL;
+}
+
+static void prof_report(void) {
+    cJSON *j_inner = cJSON_CreateObject();
+    add_scope_stats(j_inner, &command_scope);
+    ADD_PARAM_NUM("peak_rss_kb", peak_rss_kb());
+    cJSON_AddItemToObject(report, "total", j_inner);
+
+    cJSON *root = cJSON_CreateObject();
+    cJSON_AddItemToObject(root, "profile", report);
+    char *out = cJSON_Print(root);
+    FILE *f = report_path ? fopen(report_path, "w") : stderr;
+    if (out && f) {
+        fprintf(f, "%s\n", out);
+        if (f != stderr)
+            fclose(f);
+    } else if (!f)
+        fprintf(stderr, "profile: cannot write %s\n", report_path);
+    free(out);
+    cJSON_Delete(root);
+    prof_enabled = false;
+}
+
+void prof_start(const char *command, const char *path) {
+    prof_enabled = true;
+    report_path = path;
+    report = cJSON_CreateObject();
+    cJSON_AddItemToObject(report, "command", cJSON_CreateString(command));
+    prof_begin(&command_scope, "command", command);
+    atexit(prof_report);
+}
+
+static read_register_t hal_i2c_read, hal_spi_read;
+static write_register_t hal_i2c_write, hal_spi_write;
+
+static int prof_i2c_read(int fd, unsigned char i2c_addr, unsigned int reg_addr,
+                         unsigned int reg_width, unsigned int data_width) {
+    PROF_COUNT(PROF_I2C, 1);
+    return hal_i2c_read(fd, i2c_addr, reg_addr, reg_width, data_width);
+}
+
+static int prof_i2c_write(int fd, unsigned char i2c_addr,
+                          unsigned int reg_addr, unsigned int reg_width,
+                          unsigned int data, unsigned int data_width) {
+    PROF_COUNT(PROF_I2C, 1);
+    return hal_i2c_write(fd, i2c_addr, reg_addr, reg_width, data, data_width);
+}
+
+static int prof_spi_read(int fd, unsigned char i2c_addr, unsigned int reg_addr,
+                         unsigned int reg_width, unsigned int data_width) {
+    PROF_COUNT(PROF_SPI, 1);
+    return hal_spi_read(fd, i2c_addr, reg_addr, reg_width, data_width);
+}
+
+static int prof_spi_write(int fd, unsigned char i2c_addr,
+                          unsigned int reg_addr, unsigned int reg_width,
+                          unsigned int data, unsigned int data_width) {
+    PROF_COUNT(PROF_SPI, 1);
+    return hal_spi_write(fd, i2c_addr, reg_addr, reg_width, data, data_width);
+}
+
+#define WRAP_HAL(ptr, saved, wrapper)                                          \
+    do {                                                                       \
+        if (ptr && ptr != wrapper) {                                           \
+            saved = ptr;                                                       \
+            ptr = wrapper;                                                     \
+        }                                                                      \
+    } while (0)
+
+void prof_wrap_hal(void) {
+    if (!prof_enabled)
+        return;
+    WRAP_HAL(i2c_read_register, hal_i2c_read, prof_i2c_read);
+    WRAP_HAL(i2c_write_register, hal_i2c_write, prof_i2c_write);
+    WRAP_HAL(spi_read_register, hal_spi_read, prof_spi_read);
+    WRAP_HAL(spi_write_register, hal_spi_write, prof_spi_write);
+}
+
+prof_read_fn prof_hal_read(prof_read_fn fn) {
+    if (fn == prof_i2c_read)
+        return hal_i2c_read;
+    if (fn == prof_spi_read)
+        return hal_spi_read;
+    return fn;
+}
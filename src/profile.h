@@ -0,0 +1,57 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Lightweight instrumentation behind `ipctool --profile`.
+ *
+ * Counters are plain array slots bumped unconditionally at the few places
+ * that touch hardware or the kernel (mem_reg(), regex compiles, file
+ * helpers in tools.c, ioctl() and read() through link-time wrappers, I2C /
+ * SPI through wrapped HAL callbacks), so they cost one add when profiling
+ * is off. Scopes record
+ * wall time and counter deltas between prof_begin() and prof_end() and
+ * do nothing unless prof_enabled is set. */
+
+enum prof_counter {
+    PROF_MEM_REG,
+    PROF_I2C,
+    PROF_SPI,
+    PROF_IOCTL,
+    PROF_READ_BYTES,
+    PROF_REGEX,
+    PROF_COUNTERS,
+};
+
+extern bool prof_enabled;
+extern uint64_t prof_counters[PROF_COUNTERS];
+
+#define PROF_COUNT(c, n) (prof_counters[c] += (n))
+
+struct prof_scope {
+    const char *group;
+    char name[48];
+    uint64_t t0_ns;
+    uint64_t c0[PROF_COUNTERS];
+    long rss0_kb;
+};
+
+// `group` selects the array the record lands in: "build_yaml", "do_flash"
+void prof_begin(struct prof_scope *s, const char *group, const char *name);
+void prof_end(struct prof_scope *s);
+
+// whole-run scope for `command`; the report is written at exit to stderr
+// or to `path`
+void prof_start(const char *command, const char *path);
+
+// counts I2C / SPI register accesses through the installed HAL
+void prof_wrap_hal(void);
+
+// the HAL's own read callback behind a wrapper installed by prof_wrap_hal()
+typedef int (*prof_read_fn)(int fd, unsigned char i2c_addr,
+                            unsigned int reg_addr, unsigned int reg_width,
+                            unsigned int data_width);
+prof_read_fn prof_hal_read(prof_read_fn fn);
+
+#endif /* PROFILE_H */
@@ -0,0 +1,34 @@
+/* Link-time wrappers feeding the --profile counters: the ipctool link maps
+ * ioctl() and read() calls here (-Wl,--wrap=...). In the -static build
+ * that also covers libc.a members calling them by those names, so the
+ * counters may include libc's own calls there. Under --sim, ioctl() also
+ * answers MTD requests on flash image files. */
+
+#include <stdarg.h>
+#include <sys/types.h>
+
+#include "profile.h"
+#include "sim.h"
+
+int __real_ioctl(int fd, unsigned long request, ...);
+ssize_t __real_read(int fd, void *buf, size_t count);
+
+int __wrap_ioctl(int fd, unsigned long request, ...) {
+    va_list ap;
+    va_start(ap, request);
+    void *arg = va_arg(ap, void *);
+    va_end(ap);
+
+    PROF_COUNT(PROF_IOCTL, 1);
+    int ret;
+    if (sim_mtd_ioctl(fd, request, arg, &ret))
+        return ret;
+    return __real_ioctl(fd, request, arg);
+}
+
+ssize_t __wrap_read(int fd, void *buf, size_t count) {
+    ssize_t n = __real_read(fd, buf, count);
+    if (n > 0)
+        PROF_COUNT(PROF_READ_BYTES, n);
+    return n;
+}
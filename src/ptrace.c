@@ -2,21 +2,29 @@
 #include "ptrace.h"
 
 #include <assert.h>
+#include <dirent.h>
 #include <errno.h>
 #include <fcntl.h>
 #include <getopt.h>
+#include <linux/audit.h>
+#include <linux/filter.h>
 #include <linux/i2c-dev.h>
 #include <linux/i2c.h>
+#include <linux/seccomp.h>
 #include <mtd/mtd-abi.h>
+#include <signal.h>
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/prctl.h>
 #include <sys/ptrace.h>
 #include <sys/types.h>
 #include <sys/uio.h>
 #include <sys/user.h>
+#include <sys/utsname.h>
 #include <sys/wait.h>
 #include <time.h>
 #include <unistd.h>
@@ -27,6 +35,9 @@
 #include "hal/hisi/ptrace.h"
 #include "hal/xm.h"
 #include "hashtable.h"
+#include "tools.h"
+#include "trace_rec.h"
+#include "trace_timeline.h"
 
 #define ASSERT_PTRACE                                                          \
     if (ret == -1 && errno) {                                                  \
@@ -89,12 +100,19 @@ typedef struct {
 
     ioctl_enter_hook ioctl_enter;
     ioctl_exit_hook ioctl_exit;
+
+    enum trace_fd_class fd_class;
 } mon_fd_t;
 
 typedef struct process {
     pid_t pid;
     struct user regs;
     size_t syscall_num;
+    // between syscall-enter and exit; syscall_num can be 0 (restart_syscall)
+    bool in_syscall;
+    // seccomp stop seen, the kernel's own syscall-enter stop still to come
+    bool await_entry;
+    uint64_t enter_ns; // syscall entry, for --stats and record durations
 #define MAX_MON_FDS 1024
     mon_fd_t fds[MAX_MON_FDS];
 } process_t;
@@ -102,6 +120,62 @@ typedef struct process {
 HashTable pids;
 static bool trace_debug = false;
 
+/* Decoders print pseudocode to trace_out. With --binary it is a memstream
+ * whose text becomes TRACE_TEXT records, while the frequent register and
+ * usleep lines go through emit() as fixed records without any stdio */
+static FILE *trace_out;
+static bool binary_out = false;
+static char *text_buf;
+static size_t text_len;
+// the stop being decoded, stamped on every record it produces
+static struct trace_rec cur;
+
+static bool stats_enabled = false;
+// --quiet: only --stats output, the decoders just track fds
+static bool stats_quiet = false;
+// --timeline=FILE, written when tracing ends
+static FILE *timeline_out;
+
+static void open_text_buf() {
+    trace_out = open_memstream(&text_buf, &text_len);
+    if (!trace_out) {
+        perror("open_memstream");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void flush_text() {
+    if (!binary_out)
+        return;
+    fflush(trace_out);
+    if (!text_len)
+        return;
+    struct trace_rec r = cur;
+    r.op = TRACE_TEXT;
+    r.len = text_len;
+    trace_rec_write(&r, text_buf);
+    fclose(trace_out);
+    free(text_buf);
+    open_text_buf();
+}
+
+static void emit(enum trace_op op, uint32_t a, uint32_t b, int32_t ret) {
+    struct trace_rec r = cur;
+    r.op = op;
+    r.a = a;
+    r.b = b;
+    r.ret = ret;
+    r.len = 0;
+    if (timeline_out)
+        timeline_add(&r);
+    if (!binary_out) {
+        trace_rec_print(trace_out, &r, NULL);
+        return;
+    }
+    flush_text();
+    trace_rec_write(&r, NULL);
+}
+
 static void dump_regs(struct user const *regs, FILE *outfp) {
     fprintf(outfp, "r0   = 0x%08lx, r1 = 0x%08lx\n", regs->regs.uregs[0],
             regs->regs.uregs[1]);
@@ -115,20 +189,6 @@ static void dump_regs(struct user const *regs, FILE *outfp) {
             regs->regs.uregs[9]);
 }
 
-/*
-void linux_new_mempeek() {
-  // Build iovec structs
-  struct iovec local[1];
-  local[0].iov_base = calloc(len, sizeof(char));
-  local[0].iov_len = len;
-
-  struct iovec remote[1];
-  remote[0].iov_base = remoteptr;
-  remote[0].iov_len = len;
-
-  ssize_t nread = process_vm_readv(child, local, 2, remote, 1, 0);
-}*/
-
 // https://chromium.googlesource.com/chromiumos/docs/+/master/constants/syscalls.md#arm-32_bit_EABI
 #define SYSCALL_READ 3
 #define SYSCALL_WRITE 4
@@ -138,53 +198,150 @@ void linux_new_mempeek() {
 #define SYSCALL_NANOSLEEP 0xa2
 #define SYSCALL_WRITEV 146
 #define SYSCALL_OPENAT 322
+#define SYSCALL_PROCESS_VM_READV 376
+
+// older libc headers predate seccomp filters
+#ifndef PTRACE_EVENT_SECCOMP
+#define PTRACE_O_TRACESECCOMP 0x80
+#define PTRACE_EVENT_SECCOMP 7
+#endif
+#ifndef PR_SET_NO_NEW_PRIVS
+#define PR_SET_NO_NEW_PRIVS 38
+#endif
+#ifndef PTRACE_SEIZE
+#define PTRACE_SEIZE 0x4206
+#define PTRACE_INTERRUPT 0x4207
+#define PTRACE_EVENT_STOP 128
+#endif
+#ifndef PTRACE_O_EXITKILL
+#define PTRACE_O_EXITKILL 0x100000
+#endif
+
+/* Tracee memory is read in bulk: process_vm_readv() (Linux 3.2+, called
+ * through syscall() as older libcs lack the wrapper), else pread() on
+ * /proc/PID/mem, else one PTRACE_PEEKTEXT per word. The first method the
+ * kernel refuses outright is not tried again. */
+enum peek_method { PEEK_VM_READV, PEEK_PROC_MEM, PEEK_TEXT };
+static enum peek_method peek_method = PEEK_VM_READV;
+
+static int mem_fd = -1;
+static pid_t mem_pid;
+
+// /proc/PID/mem of the last tracee read, kept open between calls
+static int proc_mem_fd(pid_t child) {
+    if (mem_fd >= 0 && mem_pid == child)
+        return mem_fd;
+    if (mem_fd >= 0)
+        close(mem_fd);
+    char path[32];
+    snprintf(path, sizeof(path), "/proc/%d/mem", child);
+    mem_fd = open(path, O_RDONLY | O_CLOEXEC);
+    mem_pid = child;
+    return mem_fd;
+}
+
+// aligned words, so no read straddles into a following unmapped page
+static ssize_t peek_text(pid_t child, size_t addr, void *ptr, size_t size) {
+    unsigned char *buf = ptr;
+    size_t done = 0;
+    errno = 0;
+    while (done < size) {
+        size_t off = (addr + done) % sizeof(long);
+        long word = ptrace(PTRACE_PEEKTEXT, child, addr + done - off, 0);
+        if (word == -1 && errno)
+            return done ? (ssize_t)done : -1;
+        size_t n = MIN(sizeof(word) - off, size - done);
+        memcpy(buf + done, (unsigned char *)&word + off, n);
+        done += n;
+    }
+    return done;
+}
+
+// up to `size` bytes; fewer when the range runs into an unmapped page
+static ssize_t read_process(pid_t child, size_t addr, void *ptr, size_t size) {
+    ssize_t ret;
+    switch (peek_method) {
+    case PEEK_VM_READV: {
+        struct iovec local = {.iov_base = ptr, .iov_len = size};
+        struct iovec remote = {.iov_base = (void *)addr, .iov_len = size};
+        ret = syscall(SYSCALL_PROCESS_VM_READV, child, &local, 1, &remote, 1,
+                      0);
+        if (ret != -1 || errno != ENOSYS)
+            return ret;
+        peek_method = PEEK_PROC_MEM;
+    }
+    // fall through
+    case PEEK_PROC_MEM: {
+        int fd = proc_mem_fd(child);
+        if (fd >= 0) {
+            ret = pread(fd, ptr, size, addr);
+            // a stale fd of an exited thread reads as EOF
+            if (ret || !size)
+                return ret;
+            close(mem_fd);
+            mem_fd = -1;
+            if ((fd = proc_mem_fd(child)) >= 0)
+                return pread(fd, ptr, size, addr);
+        }
+        if (errno != ENOENT && errno != EACCES)
+            return -1;
+        peek_method = PEEK_TEXT;
+    }
+    // fall through
+    case PEEK_TEXT:
+        return peek_text(child, addr, ptr, size);
+    }
+    return -1;
+}
 
 static void *copy_from_process(pid_t child, size_t addr, void *ptr,
                                size_t size) {
-    size_t *buf = ptr;
     errno = 0;
-    for (size_t i = 0; i < size; i += sizeof(size_t)) {
-        long ret = ptrace(PTRACE_PEEKTEXT, child, addr + i, 0);
-        if (ret == -1 && errno) {
-            printf("error copy_from_process from %#x (%s)\n", addr,
-                   strerror(errno));
-            return NULL;
-        }
-        buf[i / sizeof(size_t)] = ret;
+    ssize_t ret = read_process(child, addr, ptr, size);
+    if (ret != (ssize_t)size) {
+        fprintf(trace_out, "error copy_from_process from %#zx (%s)\n", addr,
+                ret < 0 ? strerror(errno) : "short read");
+        return NULL;
     }
     return ptr;
 }
 
+/* Reads one page at a time, never past the page holding the terminator, so
+ * a string ending just before an unmapped page still comes back whole */
 static char *copy_from_process_str(process_t *proc, size_t addr) {
-    long ret;
-    ssize_t buflen = 1024;
-    char *buf = malloc(buflen);
-    ssize_t readlen = 0;
-
-    errno = 0;
-    do {
-        if (buflen == readlen) {
-            buflen *= 2;
+    static size_t page_size;
+    if (!page_size)
+        page_size = sysconf(_SC_PAGESIZE);
+
+    size_t buflen = 0, readlen = 0;
+    char *buf = NULL;
+    for (;;) {
+        size_t chunk = page_size - (addr + readlen) % page_size;
+        if (readlen + chunk + 1 > buflen) {
+            buflen = MAX(buflen * 2, readlen + chunk + 1);
             buf = realloc(buf, buflen);
             assert(buf);
         }
-        ret = ptrace(PTRACE_PEEKTEXT, proc->pid, addr + readlen, 0);
-        if (ret == -1 && errno) {
-            printf("error copy_from_process_str from %#x (%s)\n", addr,
-                   strerror(errno));
+        errno = 0;
+        ssize_t ret = read_process(proc->pid, addr + readlen, buf + readlen,
+                                   chunk);
+        if (ret <= 0) {
+            fprintf(trace_out, "error copy_from_process_str from %#zx (%s)\n",
+                    addr, ret < 0 ? strerror(errno) : "short read");
             free(buf);
             return NULL;
         }
-        *(size_t *)(buf + readlen) = ret;
-        readlen += sizeof(size_t);
-    } while (!memchr(&ret, 0, sizeof(ret)));
-    return buf;
+        char *nul = memchr(buf + readlen, 0, ret);
+        readlen += ret;
+        if (nul)
+            return buf;
+    }
 }
 
 static void xm_i2c_change_addr(int new_addr) {
     static int old_addr;
     if (old_addr != new_addr) {
-        printf("sensor_i2c_change_addr(%#x)\n", new_addr);
+        emit(TRACE_I2C_ADDR, new_addr, 0, 0);
         old_addr = new_addr;
     }
 }
@@ -197,13 +354,7 @@ static void xm_decode_i2c_read(pid_t child, uint32_t arg, ssize_t sysret) {
         return;
 
     xm_i2c_change_addr(i2c_data.dev_addr);
-    printf("sensor_read_register(%#x); /* ", i2c_data.reg_addr);
-    if (sysret != -1) {
-        printf("-> %#x", i2c_data.data);
-    } else {
-        printf("[err]");
-    }
-    printf(" */\n");
+    emit(TRACE_REG_READ, i2c_data.reg_addr, i2c_data.data, sysret);
 }
 
 static void xm_decode_i2c_write(pid_t child, uint32_t arg, ssize_t sysret) {
@@ -214,8 +365,7 @@ static void xm_decode_i2c_write(pid_t child, uint32_t arg, ssize_t sysret) {
         return;
 
     xm_i2c_change_addr(i2c_data.dev_addr);
-    printf("sensor_write_register(%#x, %#x);\n", i2c_data.reg_addr,
-           i2c_data.data);
+    emit(TRACE_REG_WRITE, i2c_data.reg_addr, i2c_data.data, sysret);
 }
 
 static void ssp_decode_read(int phase, pid_t child, uint32_t arg,
@@ -230,7 +380,7 @@ static void ssp_decode_read(int phase, pid_t child, uint32_t arg,
     if (phase == 1) {
         addr = value >> 8;
     } else if (phase == 2) {
-        printf("ssp_read_register(%#x); /* -> %#x */\n", addr, value & 0xff);
+        emit(TRACE_REG_READ, addr, value & 0xff, sysret);
     }
 }
 
@@ -241,7 +391,7 @@ static void ssp_decode_write(pid_t child, uint32_t arg, ssize_t sysret) {
     if (ret == NULL)
         return;
 
-    printf("ssp_write_register(%#x, %#x);\n", value >> 8, value & 0xff);
+    emit(TRACE_REG_WRITE, value >> 8, value & 0xff, sysret);
 }
 
 static void hisi_decode_sns_read(int phase, pid_t child, uint32_t arg,
@@ -276,13 +426,8 @@ static void hisi_decode_sns_read(int phase, pid_t child, uint32_t arg,
         if (ret == NULL)
             return;
 
-        printf("sensor_read_register(%#hx); /* ", reg_addr);
-        if (sysret == 2) {
-            printf("-> %#x", buf[0]);
-        } else {
-            printf("[err]");
-        }
-        printf(" */\n");
+        // both messages of the I2C_RDWR pair must go through
+        emit(TRACE_REG_READ, reg_addr, buf[0], sysret == 2 ? sysret : -1);
     }
 }
 
@@ -317,8 +462,8 @@ static void null_i2c_ioctl_exit_cb(process_t *proc, int fd, unsigned int cmd,
 static void dump_i2c_ioctl_exit_cb(process_t *proc, int fd, unsigned int cmd,
                                    size_t arg, ssize_t sysret) {
     if (proc->fds[fd].file)
-        printf("ioctl_i2c('%s', 0x%x, 0x%x)\n", arc_cstr(proc->fds[fd].file),
-               cmd, arg);
+        fprintf(trace_out, "ioctl_i2c('%s', 0x%x, 0x%x)\n",
+                arc_cstr(proc->fds[fd].file), cmd, arg);
 }
 
 static void null_ioctl_exit_cb(process_t *proc, int fd, unsigned int cmd,
@@ -327,8 +472,8 @@ static void null_ioctl_exit_cb(process_t *proc, int fd, unsigned int cmd,
 static void dump_ioctl_exit_cb(process_t *proc, int fd, unsigned int cmd,
                                size_t arg, ssize_t sysret) {
     if (proc->fds[fd].file)
-        printf("ioctl('%s'(%d), 0x%x, 0x%x)\n", arc_cstr(proc->fds[fd].file),
-               fd, cmd, arg);
+        fprintf(trace_out, "ioctl('%s'(%d), 0x%x, 0x%x)\n",
+                arc_cstr(proc->fds[fd].file), fd, cmd, arg);
 }
 
 typedef struct {
@@ -342,15 +487,15 @@ static void xm_gpio_open(process_t *proc, size_t arg) {
 
     void *ret = copy_from_process(proc->pid, arg, &desc, sizeof(desc));
 
-    printf("XM_GPIO_REQUEST(GPIO%d_%d) = [%#x]\n", desc.group, desc.num,
-           desc.handle);
+    fprintf(trace_out, "XM_GPIO_REQUEST(GPIO%d_%d) = [%#x]\n", desc.group,
+            desc.num, desc.handle);
 }
 
 static void xm_gpio_req(process_t *proc, size_t arg, const char *op) {
     uint32_t d[2] = {0};
 
     void *ret = copy_from_process(proc->pid, arg, &d, sizeof(d));
-    printf("%s([%#x], %#x)\n", op, d[0], d[1]);
+    fprintf(trace_out, "%s([%#x], %#x)\n", op, d[0], d[1]);
 }
 
 static void xm_gpio_ioctl_exit_cb(process_t *proc, int fd, unsigned int cmd,
@@ -365,10 +510,10 @@ static void xm_gpio_ioctl_exit_cb(process_t *proc, int fd, unsigned int cmd,
     case 0x40084704:
         return xm_gpio_req(proc, arg, "XM_GPIO_DIRECTION_SET");
     case 0x40044709:
-        puts("XM_GPIO_PRINT()");
+        fputs("XM_GPIO_PRINT()\n", trace_out);
         break;
     case 0x4004470A:
-        puts("XM_DEMUX_CLEAR()");
+        fputs("XM_DEMUX_CLEAR()\n", trace_out);
         break;
     default:
         dump_ioctl_exit_cb(proc, fd, cmd, arg, 0);
@@ -392,6 +537,10 @@ static void enter_syscall(process_t *proc) {
     ASSERT_PTRACE;
 
     proc->syscall_num = proc->regs.regs.uregs[7];
+    proc->in_syscall = true;
+    proc->enter_ns = cur.ts_ns;
+    if (stats_quiet)
+        return;
     switch (proc->syscall_num) {
     case SYSCALL_IOCTL: {
         syscall_ioctl_enter(proc);
@@ -425,7 +574,7 @@ static void hisi_i2c_read_exit_cb(process_t *proc, int fd, unsigned int cmd,
                                   size_t arg, ssize_t sysret) {
     switch (cmd) {
     case I2C_SLAVE_FORCE:
-        printf("sensor_i2c_change_addr(0x%x);\n", arg << 1);
+        emit(TRACE_I2C_ADDR, arg << 1, 0, sysret);
         break;
     case I2C_RDWR:
         hisi_decode_sns_read(2, proc->pid, arg, sysret);
@@ -452,7 +601,7 @@ static void dump_hisi_read_mipi(pid_t child, unsigned int cmd,
     if (!copy_from_process(child, remote_addr, buf, stsize))
         return;
 
-    hisi_dump_combo_dev_attr(buf, cmd);
+    hisi_dump_combo_dev_attr(trace_out, buf, cmd);
 }
 
 static void dump_hisi_vi_dev_attr(pid_t child, unsigned int cmd,
@@ -462,7 +611,7 @@ static void dump_hisi_vi_dev_attr(pid_t child, unsigned int cmd,
     if (!copy_from_process(child, remote_addr, buf, stsize))
         return;
 
-    hisi_dump_vi_dev_attr(buf, cmd);
+    hisi_dump_vi_dev_attr(trace_out, buf, cmd);
 }
 
 static void hisi_mipi_ioctl_exit_cb(process_t *proc, int fd, unsigned int cmd,
@@ -487,7 +636,7 @@ static void hisi_mipi_ioctl_exit_cb(process_t *proc, int fd, unsigned int cmd,
         dump_hisi_vi_dev_attr(proc->pid, cmd, arg);
         break;
     default:
-        printf("ERR: uknown cmd %#x for himipi\n", cmd);
+        fprintf(trace_out, "ERR: uknown cmd %#x for himipi\n", cmd);
     }
 }
 
@@ -517,9 +666,9 @@ static void hisi_gen2_read_exit_cb(process_t *proc, int fd, size_t remote_addr,
     copy_from_process(proc->pid, remote_addr, buf, nbyte);
     // reg_width
     if (nbyte == 2) {
-        printf("i2c_read() = 0x%x\n", *(u_int16_t *)buf);
+        fprintf(trace_out, "i2c_read() = 0x%x\n", *(u_int16_t *)buf);
     } else {
-        printf("i2c_read() = 0x%x\n", *(u_int8_t *)buf);
+        fprintf(trace_out, "i2c_read() = 0x%x\n", *(u_int8_t *)buf);
     }
 }
 
@@ -530,20 +679,20 @@ static void hisi_gen2_read_exit_cb(process_t *proc, int fd, size_t remote_addr,
 static void hisi_gen2_ioctl_exit_cb(process_t *proc, int fd, unsigned int cmd,
                                     size_t arg, ssize_t sysret) {
     if (cmd == I2C_SLAVE_FORCE)
-        printf("sensor_i2c_change_addr(0x%x);\n", arg << 1);
+        emit(TRACE_I2C_ADDR, arg << 1, 0, sysret);
 }
 
 static void default_read_exit_cb(process_t *proc, int fd, size_t remote_addr,
                                  size_t nbyte, ssize_t sysret) {
 #if 0
-    printf("read(%d, ..., %d)\n", fd, nbyte);
+    fprintf(trace_out, "read(%d, ..., %d)\n", fd, nbyte);
 #endif
 }
 
 static void default_write_exit_cb(process_t *proc, int fd, size_t remote_addr,
                                   size_t nbyte, ssize_t sysret) {
 #if 0
-    printf("write(%d, ..., %d)\n", fd, nbyte);
+    fprintf(trace_out, "write(%d, ..., %d)\n", fd, nbyte);
 #endif
 }
 
@@ -553,8 +702,9 @@ static void i2c_write_exit_cb(process_t *proc, int fd, size_t remote_addr,
         return;
     unsigned char *buf = alloca(nbyte);
     if (!copy_from_process(proc->pid, remote_addr, buf, nbyte)) {
-        printf("ERROR: write(%d, 0x%x, %d) -> read from addrspace\n", fd,
-               remote_addr, nbyte);
+        fprintf(trace_out,
+                "ERROR: write(%d, 0x%x, %d) -> read from addrspace\n", fd,
+                remote_addr, nbyte);
         return;
     }
 
@@ -577,7 +727,7 @@ static void i2c_write_exit_cb(process_t *proc, int fd, size_t remote_addr,
         reg = le ? (buf[0] | buf[1] << 8) : (buf[0] << 8 | buf[1]);
         val = le ? (buf[2] | buf[3] << 8) : (buf[2] << 8 | buf[3]);
     }
-    printf("sensor_write_register(0x%x, 0x%x);\n", reg, val);
+    emit(TRACE_REG_WRITE, reg, val, sysret);
 }
 
 static void gpio_write_cb(process_t *proc, int fd, size_t remote_addr,
@@ -586,26 +736,28 @@ static void gpio_write_cb(process_t *proc, int fd, size_t remote_addr,
         unsigned char *buf = alloca(nbyte) + 1;
         char *res = copy_from_process(proc->pid, remote_addr, buf, nbyte);
         if (!res) {
-            printf("ERROR: gpio_write(%d, 0x%x, %d) -> read from addrspace\n",
-                   fd, remote_addr, nbyte);
+            fprintf(trace_out,
+                    "ERROR: gpio_write(%d, 0x%x, %d) -> read from addrspace\n",
+                    fd, remote_addr, nbyte);
             return;
         }
         buf[nbyte] = 0;
-        printf("gpio_write(%s, %s)\n", arc_cstr(proc->fds[fd].file), res);
+        fprintf(trace_out, "gpio_write(%s, %s)\n", arc_cstr(proc->fds[fd].file),
+                res);
     }
 }
 
 static void mtd_write_cb(process_t *proc, int fd, size_t remote_addr,
                          size_t nbyte, ssize_t sysret) {
-    printf("mtd_write(%d, %zu, 0x%x)\n", fd, remote_addr, nbyte);
+    fprintf(trace_out, "mtd_write(%d, %zu, 0x%x)\n", fd, remote_addr, nbyte);
 }
 
 static void print_args(uint32_t *b, uint32_t *a, int cnt) {
     for (int i = 0; i < cnt; i++) {
         if (*b == *a)
-            printf(", 0x%x", *(b + i));
+            fprintf(trace_out, ", 0x%x", *(b + i));
         else
-            printf(", 0x%x -> 0x%x", *(b + i), *(a + i));
+            fprintf(trace_out, ", 0x%x -> 0x%x", *(b + i), *(a + i));
     }
 }
 
@@ -645,58 +797,60 @@ static void print_ioctl_spi(process_t *proc, int fd, size_t arg,
     uint32_t d = 0;
     copy_from_process(proc->pid, arg, &d, sizeof(d));
     if (proc->fds[fd].file)
-        printf("ioctl_spi('%s', %s, &%d);\n", arc_cstr(proc->fds[fd].file),
-               name, d);
+        fprintf(trace_out, "ioctl_spi('%s', %s, &%d);\n",
+                arc_cstr(proc->fds[fd].file), name, d);
 }
 
 static void dump_an41908a_reg(const char *prefix, const char *op,
                               uint8_t reg_num, uint16_t value) {
     switch (reg_num) {
     case 0:
-        printf("%s(IRS_TGT %s %#x)\n", prefix, op, value);
+        fprintf(trace_out, "%s(IRS_TGT %s %#x)\n", prefix, op, value);
         break;
     case 0x21: {
-        printf("%s(%#x %s %#x /* FZTEST %#x, TESTEN 2 %d */)\n", prefix,
-               reg_num, op, value, value & 0x1f, value >> 7);
+        fprintf(trace_out, "%s(%#x %s %#x /* FZTEST %#x, TESTEN 2 %d */)\n",
+                prefix, reg_num, op, value, value & 0x1f, value >> 7);
     } break;
     case 0x20: {
         uint8_t h = value >> 8 & 0xff;
-        printf("%s(%#x %s %#x /* DT1 %#x, PWMMODE %#x, PWMRES %#x */)\n",
-               prefix, reg_num, op, value, value & 0xf, h & 0x1f, h >> 5);
+        fprintf(trace_out,
+                "%s(%#x %s %#x /* DT1 %#x, PWMMODE %#x, PWMRES %#x */)\n",
+                prefix, reg_num, op, value, value & 0xf, h & 0x1f, h >> 5);
     } break;
     case 0x25: {
         const char *sf = reg_num == 0x25 ? "AB" : "CD";
-        printf("%s(INTCT%s %s %#x)\n", prefix, sf, op, value);
+        fprintf(trace_out, "%s(INTCT%s %s %#x)\n", prefix, sf, op, value);
     } break;
     case 0x22:
     case 0x27: {
         const char *sf = reg_num == 0x22 ? "AB" : "CD";
         const char pp = reg_num == 0x22 ? 'A' : 'C';
         uint8_t h = value >> 8 & 0xff;
-        printf("%s(DT2%c %s %#x, PHMOD%s %s %#x)\n", prefix, pp, op,
-               value & 0xff, sf, op, h);
+        fprintf(trace_out, "%s(DT2%c %s %#x, PHMOD%s %s %#x)\n", prefix, pp, op,
+                value & 0xff, sf, op, h);
     } break;
     case 0x23:
     case 0x28: {
         const char l = reg_num == 0x23 ? 'A' : 'C';
         const char r = reg_num == 0x23 ? 'B' : 'D';
         uint8_t h = value >> 8 & 0xff;
-        printf("%s(PPW%c %s %#x, PPWA%c %s %#x)\n", prefix, l, op, value & 0xff,
-               r, op, h);
+        fprintf(trace_out, "%s(PPW%c %s %#x, PPWA%c %s %#x)\n", prefix, l, op,
+                value & 0xff, r, op, h);
     } break;
     case 0x24:
     case 0x29: {
         const char *sf = reg_num == 0x24 ? "AB" : "CD";
         const char led = reg_num == 0x24 ? 'B' : 'C';
         uint8_t h = value >> 8 & 0xff;
-        printf(
+        fprintf(
+            trace_out,
             "%s(%#x %s %#x /* PSUM%s 0x%.2x, CCWCW%s %d, BRAKE%s %d, ENDIS%s "
             "%d, LED%c %d, MICRO%s %d */)\n",
             prefix, reg_num, op, value, sf, value & 0xff, sf, h & 1, sf,
             (h >> 1) & 1, sf, (h >> 2) & 1, led, (h >> 3) & 1, sf, h >> 4);
     } break;
     default:
-        printf("%s(%#x %s %#x)\n", prefix, reg_num, op, value);
+        fprintf(trace_out, "%s(%#x %s %#x)\n", prefix, reg_num, op, value);
     }
 }
 
@@ -709,7 +863,7 @@ static void an41908a_ioctl_exit_cb(process_t *proc, int fd, unsigned int cmd,
     struct spi_ioc_transfer mesg[1] = {0};
     copy_from_process(proc->pid, arg, &mesg[0], sizeof(mesg));
     if (mesg[0].len % 3 != 0) {
-        printf("an41908a() -> errored len %d\n", mesg[0].len);
+        fprintf(trace_out, "an41908a() -> errored len %d\n", mesg[0].len);
         return;
     }
 
@@ -725,7 +879,7 @@ static void an41908a_ioctl_exit_cb(process_t *proc, int fd, unsigned int cmd,
         uint8_t reg_num = tx_buf[i] & 0x3f;
         uint16_t value = tx_buf[i + 1] | tx_buf[i + 2] << 8;
         if (reg_num > MAX_AN41908A_REG) {
-            printf("an41908a(), bad reg_num %#x\n", reg_num);
+            fprintf(trace_out, "an41908a(), bad reg_num %#x\n", reg_num);
         } else if (tx_buf[i] & 0x40) {
             if (rx_buf == NULL) {
                 rx_buf = alloca(mesg[0].len);
@@ -756,8 +910,8 @@ static void spi_ioctl_exit_cb(process_t *proc, int fd, unsigned int cmd,
     case SPI_IOC_WR_MODE: {
         uint32_t d = 0;
         copy_from_process(proc->pid, arg, &d, sizeof(d));
-        printf("ioctl_spi('%s', SPI_IOC_WR_MODE, &(%s));\n",
-               arc_cstr(proc->fds[fd].file), spi_modes(d, (char[1024]){0}));
+        fprintf(trace_out, "ioctl_spi('%s', SPI_IOC_WR_MODE, &(%s));\n",
+                arc_cstr(proc->fds[fd].file), spi_modes(d, (char[1024]){0}));
     }
         return;
     case SPI_IOC_MESSAGE(1): {
@@ -769,18 +923,18 @@ static void spi_ioctl_exit_cb(process_t *proc, int fd, unsigned int cmd,
             copy_from_process(proc->pid, mesg[0].tx_buf, tx_buf, mesg[0].len);
         }
 
-        printf("ioctl_spi('%s', SPI_IOC_MESSAGE(1), { ",
-               arc_cstr(proc->fds[fd].file));
+        fprintf(trace_out, "ioctl_spi('%s', SPI_IOC_MESSAGE(1), { ",
+                arc_cstr(proc->fds[fd].file));
         for (size_t i = 0; i < mesg[0].len; i++) {
-            printf("%s%#x", i != 0 ? ", " : "", tx_buf[i]);
+            fprintf(trace_out, "%s%#x", i != 0 ? ", " : "", tx_buf[i]);
         }
-        printf(" });\n");
+        fprintf(trace_out, " });\n");
     } break;
     default: {
         uint32_t d = 0;
         copy_from_process(proc->pid, arg, &d, sizeof(d));
-        printf("ioctl_spi('%s', %#x, &%d);\n", arc_cstr(proc->fds[fd].file),
-               cmd, d);
+        fprintf(trace_out, "ioctl_spi('%s', %#x, &%d);\n",
+                arc_cstr(proc->fds[fd].file), cmd, d);
     }
     }
 }
@@ -825,16 +979,18 @@ static void mtd_ioctl_exit_cb(process_t *proc, int fd, unsigned int cmd,
     uint32_t d[2] = {0};
     copy_from_process(proc->pid, arg, &d, sizeof(d));
     int num = 1;
-    printf("mtd_ioctl('%s'(%d), %s (0x%x)", arc_cstr(proc->fds[fd].file), fd,
-           mtd_cmd_params(cmd, &num), cmd);
+    fprintf(trace_out, "mtd_ioctl('%s'(%d), %s (0x%x)",
+            arc_cstr(proc->fds[fd].file), fd, mtd_cmd_params(cmd, &num), cmd);
     print_args((uint32_t *)ioctl_arg, d, num);
-    printf(") = %d\n", sysret);
+    fprintf(trace_out, ") = %d\n", sysret);
 }
 
 static void show_i2c_banner(int fd) {
     static int last_i2c_fd;
+    if (stats_quiet)
+        return;
     if (last_i2c_fd != fd) {
-        printf("%s i2c-%d %s\n", LINE, fd, LINE);
+        fprintf(trace_out, "%s i2c-%d %s\n", LINE, fd, LINE);
         last_i2c_fd = fd;
     }
 }
@@ -861,7 +1017,7 @@ static void free_fds(process_t *proc) {
             delete_arc_str(proc->fds[i].file);
 }
 
-static void clone_fds(process_t *parent, process_t *new) {
+static int share_fds(process_t *parent, process_t *new) {
     memcpy(new->fds, parent->fds, sizeof(new->fds));
     int cnt = 0;
     for (int i = 0; i < MAX_MON_FDS; i++)
@@ -869,7 +1025,11 @@ static void clone_fds(process_t *parent, process_t *new) {
             new->fds[i].file->ref_cnt++;
             cnt++;
         }
-    fprintf(stderr, "Cloned %d fds\n", cnt);
+    return cnt;
+}
+
+static void clone_fds(process_t *parent, process_t *new) {
+    fprintf(stderr, "Cloned %d fds\n", share_fds(parent, new));
 }
 
 // Threads cloned with CLONE_FILES share the kernel fd table - opening a
@@ -917,52 +1077,37 @@ static void broadcast_fd_close(process_t *src, int fd) {
     ht_iterate(&pids, &ctx, broadcast_fd_close_cb);
 }
 
-static void syscall_open(process_t *proc, int fd, int offset) {
-    CHECK_FD;
-
-#if 0
-    dump_regs(&scall_regs, stderr);
-#endif
-    size_t remote_addr = proc->regs.regs.uregs[0 + offset];
-    char *filename = copy_from_process_str(proc, remote_addr);
-    if (trace_debug)
-        fprintf(stderr, "open_dbg pid=%d fd=%d offset=%d file='%s'\n",
-                proc->pid, fd, offset, filename ? filename : "(null)");
-#if 0
-    printf("open('%s')\n", filename);
-#endif
-
-    // copy_from_process_str returns NULL when PEEKTEXT fails (tracee
-    // unmapped the page mid-syscall, or the open() argument is junk
-    // and the kernel is about to return EFAULT). Without this guard,
-    // the strcmp() / IS_PREFIX() calls below dereference NULL.
-    if (!filename)
-        goto done;
-
+// points `fd` at the decoders for the device `filename` (taken over)
+static void setup_fd(process_t *proc, int fd, char *filename) {
     proc->fds[fd].file = new_arc_str(filename);
     proc->fds[fd].ioctl_exit = null_ioctl_exit_cb; // dump_ioctl_exit_cb;
     proc->fds[fd].read_exit = default_read_exit_cb;
     proc->fds[fd].write_exit = default_write_exit_cb;
+    proc->fds[fd].fd_class = TRACE_FD_OTHER;
 
     if (!strcmp(filename, "/dev/hi_i2c")) {
+        proc->fds[fd].fd_class = TRACE_FD_I2C;
         proc->fds[fd].ioctl_enter = xm_i2c_ioctl_enter_cb;
         proc->fds[fd].ioctl_exit = xm_i2c_ioctl_exit_cb;
         show_i2c_banner(fd);
-        goto done;
+        return;
     }
 
     if (!strcmp(filename, "/dev/ssp")) {
+        proc->fds[fd].fd_class = TRACE_FD_SSP;
         proc->fds[fd].ioctl_enter = ssp_ioctl_enter_cb;
         proc->fds[fd].ioctl_exit = ssp_ioctl_exit_cb;
-        goto done;
+        return;
     }
 
     if (!strcmp(filename, "/dev/xm_gpio")) {
+        proc->fds[fd].fd_class = TRACE_FD_GPIO;
         proc->fds[fd].ioctl_exit = xm_gpio_ioctl_exit_cb;
-        goto done;
+        return;
     }
 
     if (IS_PREFIX(filename, "/dev/i2c-")) {
+        proc->fds[fd].fd_class = TRACE_FD_I2C;
         proc->fds[fd].write_exit = i2c_write_exit_cb;
         switch (chip_generation) {
         case HISI_V2:
@@ -983,23 +1128,52 @@ static void syscall_open(process_t *proc, int fd, int offset) {
         }
         show_i2c_banner(fd);
     } else if (IS_PREFIX(filename, "/dev/spidev2.0")) {
+        proc->fds[fd].fd_class = TRACE_FD_SPI;
         proc->fds[fd].ioctl_exit = an41908a_ioctl_exit_cb;
     } else if (IS_PREFIX(filename, "/dev/spidev")) {
+        proc->fds[fd].fd_class = TRACE_FD_SPI;
         proc->fds[fd].ioctl_exit = spi_ioctl_exit_cb;
     } else if (IS_PREFIX(filename, "/dev/mtd")) {
+        proc->fds[fd].fd_class = TRACE_FD_MTD;
         proc->fds[fd].write_exit = mtd_write_cb;
         proc->fds[fd].ioctl_enter = mtd_ioctl_enter_cb;
         proc->fds[fd].ioctl_exit = mtd_ioctl_exit_cb;
     } else if (IS_PREFIX(filename, "/sys/class/gpio/gpio")) {
+        proc->fds[fd].fd_class = TRACE_FD_GPIO;
         proc->fds[fd].write_exit = gpio_write_cb;
     } else if (!strcmp(filename, "/dev/hi_mipi") ||
                !strcmp(filename, "/dev/mipi")) {
+        proc->fds[fd].fd_class = TRACE_FD_MIPI;
         proc->fds[fd].ioctl_exit = hisi_mipi_ioctl_exit_cb;
     } else if (!strcmp(filename, "/dev/vi")) {
+        proc->fds[fd].fd_class = TRACE_FD_VI;
         proc->fds[fd].ioctl_exit = hisi_vi_ioctl_exit_cb;
     }
+}
+
+static void syscall_open(process_t *proc, int fd, int offset) {
+    CHECK_FD;
 
-done:
+#if 0
+    dump_regs(&scall_regs, stderr);
+#endif
+    size_t remote_addr = proc->regs.regs.uregs[0 + offset];
+    char *filename = copy_from_process_str(proc, remote_addr);
+    if (trace_debug)
+        fprintf(stderr, "open_dbg pid=%d fd=%d offset=%d file='%s'\n",
+                proc->pid, fd, offset, filename ? filename : "(null)");
+#if 0
+    fprintf(trace_out, "open('%s')\n", filename);
+#endif
+
+    // copy_from_process_str returns NULL when the read fails (tracee
+    // unmapped the page mid-syscall, or the open() argument is junk
+    // and the kernel is about to return EFAULT). Without this guard,
+    // the strcmp() / IS_PREFIX() calls in setup_fd() dereference NULL.
+    if (filename)
+        setup_fd(proc, fd, filename);
+
+    cur.fd_class = proc->fds[fd].fd_class;
     // CLONE_FILES siblings share the kernel fd table; mirror that here so
     // a thread peer can decode write()/ioctl()/read() on the fd that was
     // opened in this process. Without this, libsns_*.so workers that
@@ -1013,7 +1187,7 @@ static void syscall_close(process_t *proc, ssize_t sysret) {
     CHECK_FD;
 
 #if 0
-    printf("close(%d)\n", fd);
+    fprintf(trace_out, "close(%d)\n", fd);
 #endif
     if (proc->fds[fd].file) {
         delete_arc_str(proc->fds[fd].file);
@@ -1133,14 +1307,192 @@ static void syscall_nanosleep(process_t *proc, ssize_t sysret) {
 
     struct timespec req = {0};
     copy_from_process(proc->pid, remote_rqtp, &req, sizeof(req));
-    printf("usleep(%ld)\n",
-           (unsigned long)req.tv_sec * 1000000 + req.tv_nsec / 1000);
+    emit(TRACE_USLEEP, req.tv_sec * 1000000 + req.tv_nsec / 1000, 0, sysret);
 }
 
 static bool usleep_disabled = false;
 
+/* --stats: calls per (device, request) with log2 histograms, in
+ * microseconds, of their latency (syscall entry to exit, tracer stops
+ * included) and of the interval between consecutive calls. Only fds
+ * opened as a known device class and nanosleep() are counted */
+#define STAT_BUCKETS 32
+
+struct hist {
+    uint64_t sum_us;
+    uint32_t max_us;
+    uint32_t n[STAT_BUCKETS]; // [b]: below 2^b us, at least 2^(b-1)
+};
+
+typedef struct {
+    char dev[40];
+    uint32_t syscall;
+    uint32_t req; // ioctl command
+} stat_key_t;
+
+typedef struct {
+    stat_key_t key;
+    uint64_t calls;
+    uint64_t last_ns;
+    struct hist lat, gap;
+} stat_t;
+
+static HashTable stats;
+static unsigned int stats_interval = 10; // s between reports, 0: at exit
+static uint64_t stats_start_ns, stats_next_ns;
+
+static void hist_add(struct hist *h, uint64_t ns) {
+    uint32_t us = MIN(ns / 1000, UINT32_MAX);
+    int b = us ? 32 - __builtin_clz(us) : 0;
+    h->n[MIN(b, STAT_BUCKETS - 1)]++;
+    h->sum_us += us;
+    h->max_us = MAX(h->max_us, us);
+}
+
+// upper bound of the bucket holding the pct-th percentile
+static uint32_t hist_pct(const struct hist *h, uint64_t total, int pct) {
+    uint64_t want = (total * pct + 99) / 100, seen = 0;
+    for (int b = 0; b < STAT_BUCKETS; b++) {
+        seen += h->n[b];
+        if (seen >= want && seen)
+            return b < STAT_BUCKETS - 1 ? 1u << b : h->max_us;
+    }
+    return 0;
+}
+
+static void stats_add(process_t *proc) {
+    stat_key_t key;
+    memset(&key, 0, sizeof(key));
+    key.syscall = proc->syscall_num;
+    int fd = proc->regs.regs.uregs[0];
+    switch (proc->syscall_num) {
+    case SYSCALL_NANOSLEEP:
+        strcpy(key.dev, "nanosleep");
+        break;
+    case SYSCALL_IOCTL:
+        key.req = proc->regs.regs.uregs[1];
+        // fall through
+    case SYSCALL_READ:
+    case SYSCALL_WRITE:
+    case SYSCALL_WRITEV:
+        if (fd < 0 || fd >= MAX_MON_FDS ||
+            proc->fds[fd].fd_class == TRACE_FD_NONE ||
+            proc->fds[fd].fd_class == TRACE_FD_OTHER)
+            return;
+        snprintf(key.dev, sizeof(key.dev), "%s",
+                 arc_cstr(proc->fds[fd].file));
+        break;
+    default:
+        return;
+    }
+
+    stat_t *st = ht_lookup(&stats, &key);
+    if (!st) {
+        ht_insert(&stats, &key, &(stat_t){.key = key});
+        st = ht_lookup(&stats, &key);
+    }
+    hist_add(&st->lat, cur.ts_ns - proc->enter_ns);
+    if (st->calls)
+        hist_add(&st->gap, proc->enter_ns - st->last_ns);
+    st->last_ns = proc->enter_ns;
+    st->calls++;
+}
+
+static void collect_stat(void *key, void *value, void *user) {
+    stat_t ***next = user;
+    *(*next)++ = value;
+}
+
+static int cmp_stat(const void *a, const void *b) {
+    const stat_key_t *x = &(*(stat_t *const *)a)->key;
+    const stat_key_t *y = &(*(stat_t *const *)b)->key;
+    int ret = strcmp(x->dev, y->dev);
+    if (!ret)
+        ret = (x->syscall > y->syscall) - (x->syscall < y->syscall);
+    if (!ret)
+        ret = (x->req > y->req) - (x->req < y->req);
+    return ret;
+}
+
+static const char *stat_request(const stat_key_t *key, char buf[24]) {
+    switch (key->syscall) {
+    case SYSCALL_IOCTL:
+        snprintf(buf, 24, "ioctl %#x", key->req);
+        return buf;
+    case SYSCALL_READ:
+        return "read";
+    case SYSCALL_WRITE:
+        return "write";
+    case SYSCALL_WRITEV:
+        return "writev";
+    default:
+        return "";
+    }
+}
+
+static void stats_report(bool final) {
+    size_t n = stats.size;
+    stat_t **list = calloc(n + 1, sizeof(*list)), **next = list;
+    ht_iterate(&stats, &next, collect_stat);
+    qsort(list, n, sizeof(*list), cmp_stat);
+
+    // a report is the tracer's own output, not the tracee's
+    struct trace_rec saved = cur;
+    cur = (struct trace_rec){.ts_ns = saved.ts_ns};
+    double secs = (cur.ts_ns - stats_start_ns) / 1e9;
+    fprintf(trace_out,
+            "\n%s trace stats%s, %.1f s (us, p50/p99 are 2^n bounds) %s\n",
+            LINE, final ? " at exit" : "", secs, LINE);
+    fprintf(trace_out, "%-24s %-16s %8s %8s %7s %7s %7s %7s %8s %8s\n",
+            "device", "request", "calls", "rate/s", "lat_avg", "lat_p50",
+            "lat_p99", "lat_max", "gap_avg", "gap_p99");
+    for (size_t i = 0; i < n; i++) {
+        stat_t *st = list[i];
+        char req[24];
+        uint64_t gaps = st->calls - 1;
+        fprintf(trace_out,
+                "%-24s %-16s %8llu %8.1f %7llu %7u %7u %7u %8llu %8u\n",
+                st->key.dev, stat_request(&st->key, req),
+                (unsigned long long)st->calls, secs ? st->calls / secs : 0,
+                (unsigned long long)(st->lat.sum_us / st->calls),
+                hist_pct(&st->lat, st->calls, 50),
+                hist_pct(&st->lat, st->calls, 99), st->lat.max_us,
+                (unsigned long long)(gaps ? st->gap.sum_us / gaps : 0),
+                hist_pct(&st->gap, gaps, 99));
+    }
+    fflush(trace_out);
+    flush_text();
+    cur = saved;
+    free(list);
+}
+
+static void stats_tick() {
+    if (!stats_interval || cur.ts_ns < stats_next_ns)
+        return;
+    stats_report(false);
+    stats_next_ns = cur.ts_ns + stats_interval * 1000000000ULL;
+}
+
 static void exit_syscall(process_t *proc) {
     int sysret = get_syscall_ret(proc);
+    cur.syscall = proc->syscall_num;
+    cur.ret = sysret;
+    cur.dur_us = (cur.ts_ns - proc->enter_ns) / 1000;
+    // open's fd class is known once syscall_open() has seen the path
+    int fd = proc->regs.regs.uregs[0];
+    if (proc->syscall_num != SYSCALL_NANOSLEEP && fd >= 0 && fd < MAX_MON_FDS)
+        cur.fd_class = proc->fds[fd].fd_class;
+    if (stats_enabled)
+        stats_add(proc);
+    // the timeline only needs when MIPI / VI were configured, not how
+    if (timeline_out && proc->syscall_num == SYSCALL_IOCTL &&
+        (cur.fd_class == TRACE_FD_MIPI || cur.fd_class == TRACE_FD_VI))
+        timeline_add(&cur);
+    // fd bookkeeping still has to follow opens and closes
+    if (stats_quiet && proc->syscall_num != SYSCALL_OPEN &&
+        proc->syscall_num != SYSCALL_OPENAT &&
+        proc->syscall_num != SYSCALL_CLOSE)
+        return;
     switch (proc->syscall_num) {
     case SYSCALL_OPEN:
         syscall_open(proc, sysret, 0);
@@ -1169,7 +1521,7 @@ static void exit_syscall(process_t *proc) {
         break;
 #if 0
     default:
-        printf("syscall%d()\n", proc->syscall_num);
+        fprintf(trace_out, "syscall%d()\n", proc->syscall_num);
 #endif
     }
 }
@@ -1196,24 +1548,254 @@ static pid_t get_process_parent_id(const pid_t pid) {
     return ppid;
 }
 
-static void do_trace(pid_t tracee) {
+static bool seccomp_disabled = false;
+// tracee runs under the filter below: only its filtered syscalls stop
+static bool seccomp_mode = false;
+// before Linux 4.8 the seccomp stop precedes the syscall-enter stop
+static bool seccomp_before_entry = false;
+
+/* Child side: stop only on the syscalls exit_syscall() decodes. read,
+ * write and writev on fds 0-2 are the streamer's own console output and
+ * never reach a decoder, so they stay untraced. Threads and forks inherit
+ * the filter. Thread creation itself is reported by PTRACE_O_TRACECLONE
+ * whatever the filter says, so clone() is not in the list. */
+static bool install_seccomp_filter() {
+    const unsigned int traced[] = {
+        SYSCALL_OPEN,  SYSCALL_OPENAT, SYSCALL_CLOSE,
+        SYSCALL_IOCTL, SYSCALL_NANOSLEEP,
+    };
+    const unsigned int traced_io[] = {
+        SYSCALL_READ,
+        SYSCALL_WRITE,
+        SYSCALL_WRITEV,
+    };
+    // SYSCALL_NANOSLEEP goes last so --skip=usleep can drop it
+    int n_traced = ARRCNT(traced) - usleep_disabled;
+    int n_io = ARRCNT(traced_io);
+    struct sock_filter f[3 + ARRCNT(traced) + ARRCNT(traced_io) + 5];
+    int n = 0;
+
+    // program layout: arch check, one jump per syscall, then the fd
+    // check for traced_io and the two verdicts at `allow`
+    int allow = 3 + n_traced + n_io;
+    f[n++] = (struct sock_filter)BPF_STMT(BPF_LD | BPF_W | BPF_ABS,
+                                          offsetof(struct seccomp_data, arch));
+    f[n++] = (struct sock_filter)BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K,
+                                          AUDIT_ARCH_ARM, 0, allow - 2);
+    f[n++] = (struct sock_filter)BPF_STMT(BPF_LD | BPF_W | BPF_ABS,
+                                          offsetof(struct seccomp_data, nr));
+    for (int i = 0; i < n_traced; i++, n++)
+        f[n] = (struct sock_filter)BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K,
+                                            traced[i], allow + 3 - (n + 1), 0);
+    for (int i = 0; i < n_io; i++, n++)
+        f[n] = (struct sock_filter)BPF_JUMP(
+            BPF_JMP | BPF_JEQ | BPF_K, traced_io[i], allow + 1 - (n + 1), 0);
+    f[n++] = (struct sock_filter)BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ALLOW);
+    f[n++] = (struct sock_filter)BPF_STMT(BPF_LD | BPF_W | BPF_ABS,
+                                          offsetof(struct seccomp_data, args));
+    f[n++] = (struct sock_filter)BPF_JUMP(BPF_JMP | BPF_JGT | BPF_K, 2, 0, 1);
+    f[n++] = (struct sock_filter)BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_TRACE);
+    f[n++] = (struct sock_filter)BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ALLOW);
+
+    struct sock_fprog prog = {.len = n, .filter = f};
+    if (!prctl(PR_SET_SECCOMP, SECCOMP_MODE_FILTER, &prog, 0, 0))
+        return true;
+    // without CAP_SYS_ADMIN the kernel wants no_new_privs first
+    return !prctl(PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0) &&
+           !prctl(PR_SET_SECCOMP, SECCOMP_MODE_FILTER, &prog, 0, 0);
+}
+
+// "Seccomp: 2" in /proc/PID/status once the child's filter is in place
+static bool tracee_has_filter(pid_t pid) {
+    char path[64], line[80];
+    int mode = 0;
+    snprintf(path, sizeof(path), "/proc/%d/status", pid);
+    FILE *f = fopen(path, "r");
+    if (!f)
+        return false;
+    while (fgets(line, sizeof(line), f))
+        if (sscanf(line, "Seccomp: %d", &mode) == 1)
+            break;
+    fclose(f);
+    return mode == SECCOMP_MODE_FILTER;
+}
+
+static bool kernel_before(int major, int minor) {
+    struct utsname u;
+    int ma, mi;
+    if (uname(&u) || sscanf(u.release, "%d.%d", &ma, &mi) != 2)
+        return false;
+    return ma < major || (ma == major && mi < minor);
+}
+
+/* With the filter, a tracee runs freely up to its next filtered syscall
+ * and is single-stepped through that syscall's exit only. Without it,
+ * every syscall enter and exit stops. */
+static void resume(pid_t pid, int sig) {
+    process_t *proc = ht_lookup(&pids, &pid);
+    bool in_syscall = proc && proc->in_syscall;
+    ptrace(!seccomp_mode || in_syscall ? PTRACE_SYSCALL : PTRACE_CONT, pid, 0,
+           (void *)(intptr_t)sig);
+}
+
+// starts the record context of a stop of `tid`
+static void stop_context(pid_t tid) {
+    cur = (struct trace_rec){.tid = tid};
+    if (binary_out || stats_enabled || timeline_out) {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        cur.ts_ns = (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+    }
+}
+
+static volatile sig_atomic_t stop_requested;
+
+// SIGINT / SIGTERM, and SIGALRM for --duration
+static void stop_tracing(int sig) {
+    (void)sig;
+    stop_requested = 1;
+}
+
+// only there to wake sigsuspend() in wait_tracee()
+static void tracee_event(int sig) { (void)sig; }
+
+/* waitpid() for the next tracee stop, or -1 once a stop is requested. The
+ * caller keeps SIGCHLD and the stop signals blocked, so each one arriving
+ * before the wait is still pending when sigsuspend() unblocks them. */
+static pid_t wait_tracee(int *status, const sigset_t *wait_mask) {
+    while (1) {
+        pid_t pid = waitpid(-1, status, __WALL | WNOHANG);
+        if (pid)
+            return pid;
+        if (stop_requested)
+            return -1;
+        sigsuspend(wait_mask);
+    }
+}
+
+static void std_fds(process_t *proc) {
+    proc->fds[0].file = new_arc_str(strdup("stdin"));
+    proc->fds[1].file = new_arc_str(strdup("stdout"));
+    proc->fds[2].file = new_arc_str(strdup("stderr"));
+}
+
+/* A process we attach to opened its devices long ago: rebuild its fd
+ * table from /proc/PID/fd so they decode as if the open() was traced */
+static int load_fds(process_t *proc, pid_t pid) {
+    char path[64], target[256];
+    snprintf(path, sizeof(path), "/proc/%d/fd", pid);
+    DIR *dir = opendir(path);
+    if (!dir)
+        return -1;
+    std_fds(proc);
+    int cnt = 0;
+    struct dirent *de;
+    while ((de = readdir(dir))) {
+        char *end;
+        long fd = strtol(de->d_name, &end, 10);
+        if (*end || end == de->d_name || fd <= 2 || fd >= MAX_MON_FDS)
+            continue;
+        snprintf(path, sizeof(path), "/proc/%d/fd/%ld", pid, fd);
+        ssize_t len = readlink(path, target, sizeof(target) - 1);
+        if (len <= 0)
+            continue;
+        target[len] = '\0';
+        setup_fd(proc, fd, strdup(target));
+        cnt++;
+    }
+    closedir(dir);
+    return cnt;
+}
+
+/* Seizes every thread of `pid` and interrupts it; the wait loop resumes
+ * each from that stop. Threads cloned by a seized thread are attached by
+ * PTRACE_O_TRACECLONE, ones cloned meanwhile by a thread not seized yet
+ * show up on the next pass over /proc/PID/task. */
+static int seize_threads(pid_t pid, long options) {
+    char path[64];
+    snprintf(path, sizeof(path), "/proc/%d/task", pid);
+    int seized = 0;
+    pid_t first = 0;
+    for (bool added = true; added;) {
+        added = false;
+        DIR *dir = opendir(path);
+        if (!dir)
+            break;
+        struct dirent *de;
+        while ((de = readdir(dir))) {
+            pid_t tid = atoi(de->d_name);
+            if (tid <= 0 || ht_contains(&pids, &tid))
+                continue;
+            if (ptrace(PTRACE_SEIZE, tid, 0, options) == -1) {
+                // ESRCH: the thread exited since readdir()
+                if (errno != ESRCH)
+                    fprintf(stderr, "PTRACE_SEIZE %d: %s\n", tid,
+                            strerror(errno));
+                continue;
+            }
+            ptrace(PTRACE_INTERRUPT, tid, 0, 0);
+            process_t *thread = &(process_t){.pid = tid};
+            // threads share the process' fd table, read it once
+            if (first)
+                share_fds(ht_lookup(&pids, &first), thread);
+            else if (load_fds(thread, pid) >= 0)
+                first = tid;
+            ht_insert(&pids, &tid, thread);
+            added = true;
+            seized++;
+        }
+        closedir(dir);
+    }
+    return seized;
+}
+
+static void interrupt_cb(void *key, void *value, void *user) {
+    ptrace(PTRACE_INTERRUPT, *(pid_t *)key, 0, 0);
+}
+
+/* PTRACE_DETACH needs a stopped tracee: interrupt every thread and detach
+ * each at its next stop, handing over a signal it was about to receive */
+static void detach_all() {
+    ht_iterate(&pids, NULL, interrupt_cb);
+    while (!ht_is_empty(&pids)) {
+        int status;
+        pid_t tid = waitpid(-1, &status, __WALL);
+        if (tid == -1 && errno == EINTR)
+            continue;
+        if (tid == -1)
+            break;
+        process_t *proc = ht_lookup(&pids, &tid);
+        if (proc != NULL) {
+            free_fds(proc);
+            ht_erase(&pids, &tid);
+        }
+        if (!WIFSTOPPED(status))
+            continue;
+        // syscall, ptrace event and group stops carry nothing to deliver
+        int sig = WSTOPSIG(status);
+        if (sig == (SIGTRAP | 0x80) || status >> 16 || sig == SIGSTOP)
+            sig = 0;
+        ptrace(PTRACE_DETACH, tid, 0, (void *)(intptr_t)sig);
+    }
+}
+
+static void kill_cb(void *key, void *value, void *user) {
+    kill(*(pid_t *)key, SIGKILL);
+}
+
+static void do_trace(pid_t tracee, bool attach) {
     int status;
 
     ht_setup(&pids, sizeof(pid_t), sizeof(process_t), 10);
     pid_t tracer = getpid();
     trace_debug = getenv("IPCTOOL_TRACE_DEBUG") != NULL;
 
-    printf("\n[%d] child %d created\n", tracer, tracee);
-    // The child has already PTRACE_TRACEME'd itself in do_child(); a
-    // PTRACE_ATTACH on top would only return EPERM. Just wait for its
-    // post-execv() SIGTRAP.
-    process_t *mthread = &(process_t){.pid = tracee};
-    mthread->fds[0].file = new_arc_str(strdup("stdin"));
-    mthread->fds[1].file = new_arc_str(strdup("stdout"));
-    mthread->fds[2].file = new_arc_str(strdup("stderr"));
-    ht_insert(&pids, &tracee, mthread);
-
-    wait(NULL);
+    if (stats_enabled) {
+        ht_setup(&stats, sizeof(stat_key_t), sizeof(stat_t), 64);
+        stop_context(0);
+        stats_start_ns = cur.ts_ns;
+        stats_next_ns = stats_start_ns + stats_interval * 1000000000ULL;
+    }
 
     // TRACECLONE catches CLONE_VM threads (most modern multi-threaded
     // streamers). TRACEFORK/TRACEVFORK catch genuine forked children;
@@ -1231,17 +1813,68 @@ static void do_trace(pid_t tracee) {
     // inject the SIGTRAP back, killing the tracee. With TRACEEXEC the
     // kernel emits a PTRACE_EVENT_EXEC stop instead, which we recognise
     // below and skip.
+    // TRACESECCOMP turns the child's SECCOMP_RET_TRACE verdicts into
+    // PTRACE_EVENT_SECCOMP stops, our syscall-enter in seccomp mode.
+    // EXITKILL goes with it: once untraced, every filtered syscall of the
+    // child fails with ENOSYS, so it must not outlive the tracer.
     long ptraceOption = PTRACE_O_TRACECLONE | PTRACE_O_TRACEFORK |
                         PTRACE_O_TRACEVFORK | PTRACE_O_TRACESYSGOOD |
                         PTRACE_O_TRACEEXEC;
-    ptrace(PTRACE_SETOPTIONS, tracee, NULL, ptraceOption);
-    ptrace(PTRACE_SYSCALL, tracee, 0, 0);
 
-    while (1) {
-        pid_t child_waited = waitpid(-1, &status, __WALL);
+    stop_context(0);
+    if (attach) {
+        int threads = seize_threads(tracee, ptraceOption);
+        if (!threads) {
+            fprintf(stderr, "Cannot attach to %d\n", tracee);
+            exit(EXIT_FAILURE);
+        }
+        // no filter can be installed in a running process, so every
+        // syscall stops as with --no-seccomp
+        fprintf(trace_out, "\n[%d] attached to %d, %d threads\n", tracer,
+                tracee, threads);
+    } else {
+        fprintf(trace_out, "\n[%d] child %d created\n", tracer, tracee);
+        // The child has already PTRACE_TRACEME'd itself in do_child(); a
+        // PTRACE_ATTACH on top would only return EPERM. Just wait for its
+        // post-execv() SIGTRAP.
+        process_t *mthread = &(process_t){.pid = tracee};
+        std_fds(mthread);
+        ht_insert(&pids, &tracee, mthread);
+
+        wait(NULL);
+
+        seccomp_mode = tracee_has_filter(tracee);
+        seccomp_before_entry = seccomp_mode && kernel_before(4, 8);
+        if (trace_debug)
+            fprintf(stderr, "seccomp filter %s\n",
+                    seccomp_mode ? "on" : "off");
+
+        if (seccomp_mode)
+            ptraceOption |= PTRACE_O_TRACESECCOMP | PTRACE_O_EXITKILL;
+        ptrace(PTRACE_SETOPTIONS, tracee, NULL, ptraceOption);
+        resume(tracee, 0);
+    }
 
+    sigset_t block, wait_mask;
+    sigemptyset(&block);
+    sigaddset(&block, SIGCHLD);
+    sigaddset(&block, SIGINT);
+    sigaddset(&block, SIGTERM);
+    sigaddset(&block, SIGALRM);
+    sigprocmask(SIG_BLOCK, &block, &wait_mask);
+    struct sigaction sa = {.sa_handler = tracee_event};
+    sigaction(SIGCHLD, &sa, NULL);
+
+    while (1) {
+        flush_text();
+        if (stop_requested)
+            break;
+        pid_t child_waited = wait_tracee(&status, &wait_mask);
         if (child_waited == -1)
             break;
+        stop_context(child_waited);
+        if (stats_enabled)
+            stats_tick();
 
         // Signal to forward when we resume the tracee. Stays 0 for syscall
         // stops and ptrace events; gets set to the actual signal number for
@@ -1260,7 +1893,25 @@ static void do_trace(pid_t tracee) {
                 // syscall-exit for execve is delivered separately as a
                 // TRACESYSGOOD-tagged stop, so no per-process_t fixup
                 // is required here.
-                ptrace(PTRACE_SYSCALL, child_waited, 0, 0);
+                resume(child_waited, 0);
+                continue;
+            }
+            if (event == PTRACE_EVENT_STOP) {
+                // PTRACE_INTERRUPT from seize_threads(), or the first
+                // stop of a thread cloned by a seized one
+                resume(child_waited, 0);
+                continue;
+            }
+            if (event == PTRACE_EVENT_SECCOMP) {
+                // syscall entry as seen by the filter; PTRACE_SYSCALL
+                // from here stops at its exit (or at the kernel's own
+                // entry stop first on pre-4.8 kernels)
+                process_t *proc = ht_lookup(&pids, &child_waited);
+                if (proc != NULL) {
+                    enter_syscall(proc);
+                    proc->await_entry = seccomp_before_entry;
+                }
+                resume(child_waited, 0);
                 continue;
             }
             if (event == PTRACE_EVENT_CLONE || event == PTRACE_EVENT_FORK ||
@@ -1271,8 +1922,12 @@ static void do_trace(pid_t tracee) {
                     pid_t ppid = -1;
                     if (!ht_contains(&pids, &new_child)) {
                         ppid = get_process_parent_id(new_child);
+                        // threads of an attached process report its
+                        // untraced parent, they share the cloner's fds
                         if (ppid == tracer)
                             ppid = tracee;
+                        else if (!ht_contains(&pids, &ppid))
+                            ppid = child_waited;
                         process_t *thread = &(process_t){.pid = new_child};
                         process_t *parent = ht_lookup(&pids, &ppid);
                         if (parent) {
@@ -1289,24 +1944,25 @@ static void do_trace(pid_t tracee) {
                     // before further ptrace ops are well-defined.
                     // new_child's SIGSTOP arrives through the wait loop
                     // on its own and the suppression branch below plus
-                    // the bottom-of-loop PTRACE_SYSCALL resume it
+                    // the bottom-of-loop resume() restart it
                     // cleanly. (Matches strace's clone-handling pattern.)
 
-                    printf("\nparent %d created child %d\n", ppid, new_child);
+                    fprintf(trace_out, "\nparent %d created child %d\n", ppid,
+                            new_child);
                 }
 
-                ptrace(PTRACE_SYSCALL, child_waited, 0, 0);
+                resume(child_waited, 0);
                 continue;
             }
         }
 
         if (WIFEXITED(status) || WIFSIGNALED(status)) {
             if (WIFEXITED(status))
-                printf("\nchild %d exited with status %d\n", child_waited,
-                       WEXITSTATUS(status));
+                fprintf(trace_out, "\nchild %d exited with status %d\n",
+                        child_waited, WEXITSTATUS(status));
             else
-                printf("\nchild %d killed by signal %d\n", child_waited,
-                       WTERMSIG(status));
+                fprintf(trace_out, "\nchild %d killed by signal %d\n",
+                        child_waited, WTERMSIG(status));
             process_t *proc = ht_lookup(&pids, &child_waited);
             if (proc != NULL) {
                 free_fds(proc);
@@ -1324,11 +1980,13 @@ static void do_trace(pid_t tracee) {
             if (stopCode == (SIGTRAP | 0x80)) {
                 process_t *proc = ht_lookup(&pids, &child_waited);
                 if (proc != NULL) {
-                    if (!proc->syscall_num) {
+                    if (proc->await_entry) {
+                        proc->await_entry = false;
+                    } else if (!proc->in_syscall) {
                         enter_syscall(proc);
                     } else {
                         exit_syscall(proc);
-                        proc->syscall_num = 0;
+                        proc->in_syscall = false;
                     }
                 }
                 // If proc is NULL here it means a child was created with
@@ -1350,20 +2008,65 @@ static void do_trace(pid_t tracee) {
             }
         }
 
-        ptrace(PTRACE_SYSCALL, child_waited, 0,
-               (void *)(intptr_t)sig_to_inject);
+        resume(child_waited, sig_to_inject);
+    }
+
+    sigprocmask(SIG_SETMASK, &wait_mask, NULL);
+    stop_context(0);
+    if (attach) {
+        detach_all();
+        fprintf(trace_out, "\n[%d] detached from %d\n", tracer, tracee);
+    } else if (seccomp_mode && !ht_is_empty(&pids)) {
+        // stopped by a signal with the filtered child still running
+        ht_iterate(&pids, NULL, kill_cb);
+        fprintf(trace_out, "\n[%d] killed child %d\n", tracer, tracee);
+    }
+    if (stats_enabled)
+        stats_report(true);
+    flush_text();
+    if (binary_out)
+        trace_rec_flush();
+    if (timeline_out) {
+        cJSON *j = timeline_json();
+        char *s = cJSON_Print(j);
+        fprintf(timeline_out, "%s\n", s);
+        free(s);
+        cJSON_Delete(j);
+        fclose(timeline_out);
     }
 }
 
 static void do_child(const char *program, char *const argv[]) {
     ptrace(PTRACE_TRACEME, 0, 0, 0);
+    // on failure (no CONFIG_SECCOMP_FILTER) the tracer sees no filter in
+    // /proc/PID/status and stops on every syscall as before
+    if (!seccomp_disabled && !install_seccomp_filter())
+        fprintf(stderr, "seccomp filter unavailable, tracing all syscalls\n");
     execv(program, argv);
     perror("execl");
 }
 
 static int help() {
-    puts("Usage: ipctool trace [--skip=usleep] [--output=PATH] "
-         "<full/path/to/executable> [program arguments]");
+    puts("Usage: ipctool trace [--skip=usleep] [--output=PATH [--binary]] "
+         "[--stats[=SECS]] [--quiet]\n"
+         "       [--timeline=FILE] [--no-seccomp] <full/path/to/executable> "
+         "[program arguments]\n"
+         "       ipctool trace --pid=N [--duration=SECS] [same options]\n"
+         "  --binary writes a compact record stream to PATH instead of "
+         "pseudocode,\n"
+         "  read it back with `ipctool trace-decode [--json] PATH`\n"
+         "  --stats reports per device and request call rates, latency and "
+         "call\n"
+         "  intervals every SECS (default 10, 0: only at exit); --quiet "
+         "prints\n"
+         "  nothing else\n"
+         "  --timeline writes the startup phases (probe, MIPI/VI, sensor "
+         "init,\n"
+         "  mode switches, runtime) to FILE as Chrome trace JSON for\n"
+         "  chrome://tracing or ui.perfetto.dev\n"
+         "  --pid attaches to all threads of a running process, picking up "
+         "the\n"
+         "  devices it has open, and detaches after SECS or on Ctrl-C");
     return EXIT_FAILURE;
 }
 
@@ -1377,10 +2080,19 @@ int ptrace_cmd(int argc, char **argv) {
     if (argc < 2)
         return help();
 
-    const char *output_path = NULL;
+    const char *output_path = NULL, *timeline_path = NULL;
+    pid_t attach_pid = 0;
+    unsigned int duration = 0;
     const struct option long_options[] = {
         {"skip", required_argument, NULL, 's'},
         {"output", required_argument, NULL, 'o'},
+        {"no-seccomp", no_argument, NULL, 'n'},
+        {"binary", no_argument, NULL, 'b'},
+        {"stats", optional_argument, NULL, 'S'},
+        {"quiet", no_argument, NULL, 'q'},
+        {"timeline", required_argument, NULL, 't'},
+        {"pid", required_argument, NULL, 'p'},
+        {"duration", required_argument, NULL, 'd'},
         {NULL, 0, NULL, 0},
     };
     int res;
@@ -1395,23 +2107,77 @@ int ptrace_cmd(int argc, char **argv) {
         case 'o':
             output_path = optarg;
             break;
+        case 'n':
+            seccomp_disabled = true;
+            break;
+        case 'b':
+            binary_out = true;
+            break;
+        case 'q':
+            stats_quiet = true;
+            // fall through
+        case 'S':
+            stats_enabled = true;
+            if (optarg)
+                stats_interval = strtoul(optarg, NULL, 10);
+            break;
+        case 't':
+            timeline_path = optarg;
+            break;
+        case 'p':
+            attach_pid = strtol(optarg, NULL, 10);
+            break;
+        case 'd':
+            duration = strtoul(optarg, NULL, 10);
+            break;
         case '?':
             return help();
         }
     }
 
+    // the child's own stdout would corrupt a record stream
+    if (binary_out && !output_path) {
+        fputs("trace: --binary needs --output=PATH\n", stderr);
+        return help();
+    }
+    if (attach_pid <= 0 && optind >= argc)
+        return help();
+    if (attach_pid > 0 && optind < argc) {
+        fputs("trace: --pid cannot be combined with a program to run\n",
+              stderr);
+        return help();
+    }
+    // a launched child's seccomp filter fails its syscalls once untraced
+    if (duration && attach_pid <= 0) {
+        fputs("trace: --duration needs --pid=N\n", stderr);
+        return help();
+    }
+    // --quiet skips the decoders that produce the timeline's events
+    if (timeline_path && stats_quiet) {
+        fputs("trace: --timeline cannot be combined with --quiet\n", stderr);
+        return help();
+    }
+
     if (!getchipname()) {
         puts("Unknown chip");
         exit(EXIT_FAILURE);
     }
 
-    pid_t pid = fork();
+    pid_t pid = attach_pid > 0 ? attach_pid : fork();
     if (pid) {
         // Parent only: redirect trace output to PATH so the traced child's
         // stdout (e.g. streamer log lines) doesn't interleave with our
         // pseudocode emissions on the shared fd 1. Child already has its
         // own copy of fd 1 from fork() and is unaffected.
-        if (output_path) {
+        if (binary_out) {
+            int fd = open(output_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (fd < 0 || !trace_rec_open(fd)) {
+                fprintf(stderr, "open(%s) failed: %s\n", output_path,
+                        strerror(errno));
+                exit(EXIT_FAILURE);
+            }
+            open_text_buf();
+        } else if (output_path) {
             if (!freopen(output_path, "w", stdout)) {
                 fprintf(stderr, "freopen(%s) failed: %s\n", output_path,
                         strerror(errno));
@@ -1419,7 +2185,23 @@ int ptrace_cmd(int argc, char **argv) {
             }
             setvbuf(stdout, NULL, _IOLBF, 0);
         }
-        do_trace(pid);
+        if (!binary_out)
+            trace_out = stdout;
+        if (timeline_path && !(timeline_out = fopen(timeline_path, "w"))) {
+            fprintf(stderr, "open(%s) failed: %s\n", timeline_path,
+                    strerror(errno));
+            exit(EXIT_FAILURE);
+        }
+        if (binary_out || timeline_out || stats_enabled || attach_pid > 0) {
+            // Ctrl-C ends the wait loop, which flushes, prints the final
+            // stats report and detaches
+            struct sigaction sa = {.sa_handler = stop_tracing};
+            sigaction(SIGINT, &sa, NULL);
+            sigaction(SIGTERM, &sa, NULL);
+            sigaction(SIGALRM, &sa, NULL);
+        }
+        alarm(duration);
+        do_trace(pid, attach_pid > 0);
     } else {
         do_child(argv[optind], &argv[optind]);
     }
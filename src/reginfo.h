@@ -1,16 +1,22 @@
 #ifndef REGINFO_H
 #define REGINFO_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
 
-typedef const struct {
-    uint32_t address;
-    const char *funcs[];
-} muxctrl_reg_t;
+#include "pinmux.h"
 
-#define MUXCTRL(name, addr, ...)                                               \
-    static muxctrl_reg_t name = {addr, {__VA_ARGS__, 0}};
+typedef struct {
+    int group;
+    int num;
+    int value;
+} gpio_pin_t;
+
+// Drives all given pins as outputs; pins are grouped per GPIO bank and
+// each bank gets one masked data store, direction is only touched when
+// some pin isn't an output yet
+bool gpio_write_pins(const gpio_pin_t *pins, size_t n);
 
 int reginfo_cmd(int argc, char **argv);
 int gpio_cmd(int argc, char **argv);
@@ -0,0 +1,234 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "mmap.h"
+#include "regset.h"
+#include "sim.h"
+
+#define NO_REG 0xdeadbeef
+
+// Pages closer than this are mapped as one span, same window that
+// mem_reg() caches
+#define REGSET_MAX_GAP 0x10000
+#define REGSET_MAX_SPAN 0x100000
+
+struct regset_span {
+    uint32_t base;
+    uint32_t size;
+    volatile char *map;
+};
+
+struct regset {
+    size_t n;
+    size_t nspans;
+    struct regset_span *spans;
+    size_t *order;              // caller indexes sorted by address
+    volatile uint32_t **ptrs;   // per caller index, NULL for NO_REG
+    uint32_t *sim_addrs;        // caller addresses under --sim, no mapping
+};
+
+struct sort_item {
+    uint32_t addr;
+    size_t idx;
+};
+
+static int cmp_sort_item(const void *a, const void *b) {
+    const struct sort_item *x = a, *y = b;
+    if (x->addr != y->addr)
+        return x->addr < y->addr ? -1 : 1;
+    return x->idx < y->idx ? -1 : x->idx > y->idx;
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void unmap_spans(regset_t *set) {
+    for (size_t i = 0; i < set->nspans; i++)
+        if (set->spans[i].map)
+            munmap((void *)set->spans[i].map, set->spans[i].size);
+    set->nspans = 0;
+}
+
+// Walks addresses in sorted order and builds page-aligned spans. With
+// `merge` disabled every distinct page gets its own span, which is what
+// CONFIG_IO_STRICT_DEVMEM kernels need when a neighbouring page is
+// claimed by a driver.
+static void build_spans(regset_t *set, const struct sort_item *items,
+                        uint32_t page, bool merge) {
+    set->nspans = 0;
+    for (size_t k = 0; k < set->n; k++) {
+        if (items[k].addr == NO_REG)
+            continue;
+        uint32_t pbase = items[k].addr & ~(page - 1);
+        struct regset_span *last =
+            set->nspans ? &set->spans[set->nspans - 1] : NULL;
+        if (last && pbase < last->base + last->size)
+            continue;
+        if (last && merge && pbase - (last->base + last->size) <=
+                                 REGSET_MAX_GAP &&
+            pbase + page - last->base <= REGSET_MAX_SPAN) {
+            last->size = pbase + page - last->base;
+            continue;
+        }
+        struct regset_span *s = &set->spans[set->nspans++];
+        s->base = pbase;
+        s->size = page;
+        s->map = NULL;
+    }
+}
+
+static int map_spans(regset_t *set, int fd) {
+    for (size_t i = 0; i < set->nspans; i++) {
+        struct regset_span *s = &set->spans[i];
+        void *m = mmap(NULL, s->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+                       s->base);
+        if (m == MAP_FAILED)
+            return errno;
+        s->map = m;
+    }
+    return 0;
+}
+
+regset_t *regset_open(const uint32_t *addrs, size_t n) {
+    if (!n)
+        return NULL;
+
+    regset_t *set = calloc(1, sizeof(*set));
+    struct sort_item *items = calloc(n, sizeof(*items));
+    if (!set || !items)
+        goto fail;
+    set->n = n;
+    set->spans = calloc(n, sizeof(*set->spans));
+    set->order = calloc(n, sizeof(*set->order));
+    set->ptrs = calloc(n, sizeof(*set->ptrs));
+    if (!set->spans || !set->order || !set->ptrs)
+        goto fail;
+
+    for (size_t i = 0; i < n; i++) {
+        items[i].addr = addrs[i];
+        items[i].idx = i;
+    }
+    qsort(items, n, sizeof(*items), cmp_sort_item);
+
+    if (sim_dir) {
+        set->sim_addrs = malloc(n * sizeof(*set->sim_addrs));
+        if (!set->sim_addrs)
+            goto fail;
+        memcpy(set->sim_addrs, addrs, n * sizeof(*set->sim_addrs));
+        free(items);
+        return set;
+    }
+
+    int fd = open("/dev/mem", O_RDWR | O_SYNC);
+    if (fd < 0) {
+        fprintf(stderr, "can't open /dev/mem\n");
+        goto fail;
+    }
+
+    uint32_t page = (uint32_t)sysconf(_SC_PAGESIZE);
+    build_spans(set, items, page, true);
+    int err = map_spans(set, fd);
+    if (err == EPERM) {
+        unmap_spans(set);
+        build_spans(set, items, page, false);
+        err = map_spans(set, fd);
+    }
+    close(fd);
+    if (err) {
+        fprintf(stderr, "regset mmap error: %s (%d)\n", strerror(err), err);
+        goto fail;
+    }
+
+    size_t span = 0;
+    for (size_t k = 0; k < n; k++) {
+        set->order[k] = items[k].idx;
+        if (items[k].addr == NO_REG)
+            continue;
+        while (items[k].addr >= set->spans[span].base + set->spans[span].size)
+            span++;
+        set->ptrs[items[k].idx] =
+            (volatile uint32_t *)(set->spans[span].map +
+                                  (items[k].addr - set->spans[span].base));
+    }
+
+    free(items);
+    return set;
+
+fail:
+    free(items);
+    regset_close(set);
+    return NULL;
+}
+
+void regset_close(regset_t *set) {
+    if (!set)
+        return;
+    if (set->spans)
+        unmap_spans(set);
+    free(set->spans);
+    free(set->order);
+    free(set->ptrs);
+    free(set->sim_addrs);
+    free(set);
+}
+
+size_t regset_count(const regset_t *set) { return set->n; }
+
+size_t regset_spans(const regset_t *set) { return set->nspans; }
+
+void regset_read(regset_t *set, uint32_t *values) {
+    if (set->sim_addrs) {
+        for (size_t i = 0; i < set->n; i++)
+            if (set->sim_addrs[i] == NO_REG ||
+                !sim_mem_reg(set->sim_addrs[i], &values[i], OP_READ))
+                values[i] = 0;
+        return;
+    }
+    // Ascending address order keeps accesses inside one span together
+    for (size_t k = 0; k < set->n; k++) {
+        size_t i = set->order[k];
+        values[i] = set->ptrs[i] ? *set->ptrs[i] : 0;
+    }
+}
+
+void regset_snapshot(regset_t *set, uint32_t *values, regset_stamp_t *stamps,
+                     size_t samples, unsigned interval_us) {
+    uint64_t next = now_ns();
+    for (size_t s = 0; s < samples; s++) {
+        uint64_t t0 = now_ns();
+        regset_read(set, values + s * set->n);
+        if (stamps) {
+            stamps[s].ts_ns = t0;
+            stamps[s].skew_ns = (uint32_t)(now_ns() - t0);
+        }
+
+        if (!interval_us || s + 1 == samples)
+            continue;
+        // Schedule against absolute deadlines so read time doesn't
+        // accumulate into drift
+        next += (uint64_t)interval_us * 1000;
+        uint64_t now = now_ns();
+        if (next > now) {
+            struct timespec ts = {.tv_sec = (next - now) / 1000000000ULL,
+                                  .tv_nsec = (next - now) % 1000000000ULL};
+            nanosleep(&ts, NULL);
+        }
+    }
+}
+
+bool mem_reg_batch(const uint32_t *addrs, uint32_t *values, size_t n) {
+    regset_t *set = regset_open(addrs, n);
+    if (!set)
+        return false;
+    regset_read(set, values);
+    regset_close(set);
+    return true;
+}
@@ -0,0 +1,44 @@
+#ifndef REGSET_H
+#define REGSET_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Batch access to many physical registers through /dev/mem.
+ *
+ * `mem_reg()` keeps a single 64 KiB window cached, so walking registers
+ * that hop between CRG, MUXCTRL and GPIO blocks remaps on almost every
+ * call. A regset sorts the requested addresses once, coalesces them into
+ * the minimal set of page-aligned spans, maps each span once and then
+ * reads every register in a single pass. Values are always returned in
+ * the caller's order.
+ *
+ * Address 0xdeadbeef is the "no register" sentinel used by the pinmux
+ * tables and reads back as 0, same as in `mem_reg()`. */
+
+typedef struct regset regset_t;
+
+/* CLOCK_MONOTONIC time stamp of one pass over a regset */
+typedef struct {
+    uint64_t ts_ns;   /* start of the pass */
+    uint32_t skew_ns; /* pass duration: upper bound on skew between regs */
+} regset_stamp_t;
+
+regset_t *regset_open(const uint32_t *addrs, size_t n);
+void regset_close(regset_t *set);
+size_t regset_count(const regset_t *set);
+size_t regset_spans(const regset_t *set);
+
+// reads every register of the set once, values[] in caller order
+void regset_read(regset_t *set, uint32_t *values);
+
+// `samples` passes, `interval_us` apart (0 = back to back); values is a
+// samples x n matrix, stamps (optional) has one entry per pass
+void regset_snapshot(regset_t *set, uint32_t *values, regset_stamp_t *stamps,
+                     size_t samples, unsigned interval_us);
+
+// one-shot helper: open, read, close
+bool mem_reg_batch(const uint32_t *addrs, uint32_t *values, size_t n);
+
+#endif /* REGSET_H */
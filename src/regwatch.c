@@ -0,0 +1,326 @@
+/* `ipctool regwatch` -- physical-address watchpoint sampler.
+ *
+ * Samples a list of registers at a fixed rate through one cached regset
+ * mapping and logs every masked transition with a CLOCK_MONOTONIC time
+ * stamp. Addresses that belong to the chip's pinmux or clocks tables are
+ * decoded by name, so runtime reprogramming of PLLs, pads or ISP blocks
+ * by the streamer shows up as e.g.
+ *
+ *     [   12.345678] 0x12010000 cpu_pll.ctrl_reg1 0x12000000 -> 0x11000000
+ *
+ * The sampling loop never touches stdio: transitions go into a
+ * single-producer/single-consumer lock-free ring and a writer thread
+ * formats and prints them. When the writer falls behind, records are
+ * dropped and counted rather than stalling the sampler.
+ */
+
+#include <errno.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "chipid.h"
+#include "clocks.h"
+#include "pinmux.h"
+#include "regset.h"
+#include "regwatch.h"
+#include "tools.h"
+
+#define RING_SIZE 4096 // power of two
+#define MAX_WATCH 4096
+
+struct watch {
+    uint32_t addr;
+    uint32_t mask;
+    char name[48];
+    const muxctrl_reg_t *mux;
+};
+
+struct transition {
+    uint64_t ts_ns;
+    uint32_t idx;
+    uint32_t old;
+    uint32_t new;
+};
+
+static struct {
+    struct transition rec[RING_SIZE];
+    uint32_t head; // written by the sampler only
+    uint32_t tail; // written by the writer only
+    uint32_t dropped;
+} ring;
+
+static volatile sig_atomic_t stop;
+static bool sampler_done;
+
+static void on_signal(int sig) {
+    (void)sig;
+    stop = 1;
+}
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void ring_push(const struct transition *t) {
+    uint32_t head = __atomic_load_n(&ring.head, __ATOMIC_RELAXED);
+    uint32_t tail = __atomic_load_n(&ring.tail, __ATOMIC_ACQUIRE);
+    if (head - tail == RING_SIZE) {
+        __atomic_fetch_add(&ring.dropped, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    ring.rec[head & (RING_SIZE - 1)] = *t;
+    __atomic_store_n(&ring.head, head + 1, __ATOMIC_RELEASE);
+}
+
+static bool ring_pop(struct transition *t) {
+    uint32_t tail = __atomic_load_n(&ring.tail, __ATOMIC_RELAXED);
+    uint32_t head = __atomic_load_n(&ring.head, __ATOMIC_ACQUIRE);
+    if (head == tail)
+        return false;
+    *t = ring.rec[tail & (RING_SIZE - 1)];
+    __atomic_store_n(&ring.tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+static const char *mux_func(const muxctrl_reg_t *mux, uint32_t val) {
+    // Function select lives in the low nibble on HiSilicon / Goke pads
+    for (uint32_t i = 0; mux->funcs[i]; i++)
+        if (i == (val & 0xf))
+            return mux->funcs[i];
+    return "reserved";
+}
+
+struct writer_ctx {
+    const struct watch *w;
+    uint64_t t0;
+    FILE *out;
+};
+
+static void *writer_thread(void *arg) {
+    const struct writer_ctx *ctx = arg;
+    struct transition t;
+
+    for (;;) {
+        bool got = false;
+        while (ring_pop(&t)) {
+            const struct watch *w = &ctx->w[t.idx];
+            fprintf(ctx->out, "[%11.6f] 0x%08x %s 0x%08x -> 0x%08x",
+                    (t.ts_ns - ctx->t0) / 1e9, w->addr, w->name, t.old,
+                    t.new);
+            if (w->mux)
+                fprintf(ctx->out, " (%s -> %s)", mux_func(w->mux, t.old),
+                        mux_func(w->mux, t.new));
+            fputc('\n', ctx->out);
+            got = true;
+        }
+        if (got)
+            fflush(ctx->out);
+        if (__atomic_load_n(&sampler_done, __ATOMIC_ACQUIRE) &&
+            __atomic_load_n(&ring.head, __ATOMIC_ACQUIRE) ==
+                __atomic_load_n(&ring.tail, __ATOMIC_RELAXED))
+            break;
+        usleep(10000);
+    }
+    return NULL;
+}
+
+static void name_watch(struct watch *w) {
+    if (clocks_reg_name(w->addr, w->name, sizeof(w->name)))
+        return;
+
+    w->mux = pinmux_by_address(w->addr);
+    if (w->mux) {
+        // Name the pad by its GPIO function when it has one
+        const char *pad = w->mux->funcs[0];
+        for (int i = 0; w->mux->funcs[i]; i++)
+            if (!strncmp(w->mux->funcs[i], "GPIO", 4)) {
+                pad = w->mux->funcs[i];
+                break;
+            }
+        snprintf(w->name, sizeof(w->name), "muxctrl[%s]", pad);
+        return;
+    }
+
+    strcpy(w->name, "-");
+}
+
+/* ADDR[:MASK], ADDR-END[:MASK] (inclusive, 32-bit stride) or
+ * ADDR+LEN[:MASK] */
+static int parse_spec(const char *spec, struct watch *w, int room) {
+    char *end;
+    uint32_t from = strtoul(spec, &end, 0), to = from;
+    if (end == spec)
+        return -1;
+    if (*end == '-')
+        to = strtoul(end + 1, &end, 0);
+    else if (*end == '+')
+        to = from + strtoul(end + 1, &end, 0) - 4;
+    uint32_t mask = 0xffffffff;
+    if (*end == ':')
+        mask = strtoul(end + 1, &end, 0);
+    if (*end || (from & 3) || to < from)
+        return -1;
+
+    int n = 0;
+    for (uint32_t a = from; a <= to && a >= from; a += 4) {
+        if (n == room)
+            return -1;
+        w[n].addr = a;
+        w[n].mask = mask;
+        w[n].mux = NULL;
+        n++;
+    }
+    return n;
+}
+
+static void print_regwatch_usage(void) {
+    printf("Usage: ipctool regwatch [--rate HZ] [--duration S] SPEC...\n"
+           "\n"
+           "Sample physical registers and log every change with a time "
+           "stamp.\n"
+           "SPEC is ADDR[:MASK], ADDR-END[:MASK] or ADDR+LEN[:MASK]; only "
+           "bits\n"
+           "set in MASK are compared. Pinmux and clock registers of the\n"
+           "detected chip are decoded by name.\n"
+           "\n"
+           "  --rate HZ       samples per second (default: 1000)\n"
+           "  --duration S    stop after S seconds (default: until Ctrl-C)\n");
+}
+
+int regwatch_cmd(int argc, char **argv) {
+    unsigned rate = 1000;
+    unsigned duration = 0;
+
+    const struct option long_options[] = {
+        {"rate", required_argument, NULL, 'r'},
+        {"duration", required_argument, NULL, 'd'},
+        {"help", no_argument, NULL, 'h'},
+        {NULL, 0, NULL, 0},
+    };
+    int opt;
+    optind = 1;
+    while ((opt = getopt_long(argc, argv, "r:d:h", long_options, NULL)) !=
+           -1) {
+        switch (opt) {
+        case 'r':
+            rate = strtoul(optarg, NULL, 10);
+            if (rate < 1 || rate > 1000000) {
+                fprintf(stderr, "regwatch: --rate must be 1..1000000\n");
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'd':
+            duration = strtoul(optarg, NULL, 10);
+            break;
+        case 'h':
+            print_regwatch_usage();
+            return EXIT_SUCCESS;
+        default:
+            print_regwatch_usage();
+            return EXIT_FAILURE;
+        }
+    }
+    if (optind >= argc) {
+        print_regwatch_usage();
+        return EXIT_FAILURE;
+    }
+
+    static struct watch w[MAX_WATCH];
+    int n = 0;
+    for (int i = optind; i < argc; i++) {
+        int got = parse_spec(argv[i], w + n, MAX_WATCH - n);
+        if (got < 0) {
+            fprintf(stderr, "regwatch: bad spec '%s'\n", argv[i]);
+            return EXIT_FAILURE;
+        }
+        n += got;
+    }
+
+    getchipname();
+    uint32_t addrs[n];
+    for (int i = 0; i < n; i++) {
+        addrs[i] = w[i].addr;
+        name_watch(&w[i]);
+    }
+
+    regset_t *set = regset_open(addrs, n);
+    if (!set)
+        return EXIT_FAILURE;
+
+    uint32_t *cur = malloc(sizeof(uint32_t) * n * 2);
+    if (!cur) {
+        regset_close(set);
+        return EXIT_FAILURE;
+    }
+    uint32_t *prev = cur + n;
+    regset_read(set, prev);
+
+    printf("watching %d register(s) in %zu mapping(s) at %u Hz\n", n,
+           regset_spans(set), rate);
+    for (int i = 0; i < n; i++)
+        printf("0x%08x %s = 0x%08x\n", w[i].addr, w[i].name, prev[i]);
+    fflush(stdout);
+
+    struct writer_ctx ctx = {.w = w, .t0 = now_ns(), .out = stdout};
+    pthread_t writer;
+    if (pthread_create(&writer, NULL, writer_thread, &ctx)) {
+        fprintf(stderr, "regwatch: cannot start writer thread\n");
+        free(cur);
+        regset_close(set);
+        return EXIT_FAILURE;
+    }
+
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+
+    uint64_t period = 1000000000ULL / rate;
+    uint64_t deadline = duration ? ctx.t0 + duration * 1000000000ULL : 0;
+    uint64_t next = ctx.t0;
+    uint64_t samples = 0;
+    while (!stop) {
+        regset_read(set, cur);
+        uint64_t ts = now_ns();
+        samples++;
+        for (int i = 0; i < n; i++) {
+            if (!((cur[i] ^ prev[i]) & w[i].mask))
+                continue;
+            struct transition t = {
+                .ts_ns = ts, .idx = i, .old = prev[i], .new = cur[i]};
+            ring_push(&t);
+            prev[i] = cur[i];
+        }
+        if (deadline && ts >= deadline)
+            break;
+
+        next += period;
+        if (next > ts) {
+            struct timespec sl = {.tv_sec = next / 1000000000ULL,
+                                  .tv_nsec = next % 1000000000ULL};
+            clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &sl, NULL);
+        } else {
+            // Overrun: don't try to catch up with a burst of samples
+            next = ts;
+        }
+    }
+
+    __atomic_store_n(&sampler_done, true, __ATOMIC_RELEASE);
+    pthread_join(writer, NULL);
+
+    double secs = (now_ns() - ctx.t0) / 1e9;
+    fprintf(stderr, "regwatch: %llu samples in %.2f s (%.0f Hz), %u dropped\n",
+            (unsigned long long)samples, secs, samples / secs, ring.dropped);
+
+    free(cur);
+    regset_close(set);
+    return EXIT_SUCCESS;
+}
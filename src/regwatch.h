@@ -0,0 +1,6 @@
+#ifndef REGWATCH_H
+#define REGWATCH_H
+
+int regwatch_cmd(int argc, char **argv);
+
+#endif /* REGWATCH_H */
@@ -0,0 +1,358 @@
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <mtd/mtd-user.h>
+
+#include "hal/common.h"
+#include "sim.h"
+
+const char *sim_dir;
+
+struct sim_reg {
+    uint32_t addr;
+    uint32_t value;
+};
+
+// sorted by addr, looked up with bsearch()
+struct regmap {
+    struct sim_reg *r;
+    size_t n, cap;
+};
+
+static struct regmap mem_map, i2c_map, spi_map;
+static bool i2c_devs[0x100];
+
+// never a real descriptor, the simulated HAL ignores it
+#define SIM_FD 0x5100
+#define MAX_NUMS 64
+
+static int cmp_reg(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a, y = ((const struct sim_reg *)b)->addr;
+    return x < y ? -1 : x > y;
+}
+
+static struct sim_reg *find_reg(const struct regmap *m, uint32_t addr) {
+    return bsearch(&addr, m->r, m->n, sizeof(*m->r), cmp_reg);
+}
+
+static bool set_reg(struct regmap *m, uint32_t addr, uint32_t value) {
+    struct sim_reg *r = find_reg(m, addr);
+    if (r) {
+        r->value = value;
+        return true;
+    }
+    if (m->n == m->cap) {
+        size_t cap = m->cap ? m->cap * 2 : 256;
+        struct sim_reg *p = realloc(m->r, cap * sizeof(*p));
+        if (!p)
+            return false;
+        m->r = p;
+        m->cap = cap;
+    }
+    size_t i = m->n;
+    while (i && m->r[i - 1].addr > addr)
+        i--;
+    memmove(m->r + i + 1, m->r + i, (m->n - i) * sizeof(*m->r));
+    m->r[i] = (struct sim_reg){addr, value};
+    m->n++;
+    return true;
+}
+
+// I2C map key: 8-bit device address above a 16-bit register
+static uint32_t i2c_key(unsigned char dev, unsigned int reg) {
+    return (uint32_t)dev << 16 | (reg & 0xffff);
+}
+
+/* Numbers on a line after any leading words (`ipctool i2cset`, `devmem`);
+ * the width column of `devmem ADDR 32 VALUE` is dropped */
+static int parse_line(char *line, uint32_t *v) {
+    bool devmem = false;
+    int n = 0;
+    for (char *tok = strtok(line, " \t\r\n"); tok && n < MAX_NUMS;
+         tok = strtok(NULL, " \t\r\n")) {
+        if (*tok == '#')
+            break;
+        char *end;
+        unsigned long x = strtoul(tok, &end, 0);
+        if (*end) {
+            if (n)
+                break;
+            devmem |= !strcmp(tok, "devmem");
+            continue;
+        }
+        v[n++] = x;
+    }
+    if (devmem) {
+        if (n != 3)
+            return 0;
+        v[1] = v[2];
+        n = 2;
+    }
+    return n;
+}
+
+enum map_kind { MAP_MEM, MAP_I2C, MAP_SPI };
+
+static bool load_map(const char *name, enum map_kind kind) {
+    char path[PATH_MAX], line[1024];
+    snprintf(path, sizeof(path), "%s/%s", sim_dir, name);
+    FILE *f = fopen(path, "r");
+    if (!f)
+        return errno == ENOENT;
+
+    uint32_t v[MAX_NUMS];
+    int lineno = 0;
+    bool ok = true;
+    while (ok && fgets(line, sizeof(line), f)) {
+        lineno++;
+        int n = parse_line(line, v);
+        if (!n)
+            continue;
+        switch (kind) {
+        case MAP_MEM:
+            if (n < 2)
+                goto bad;
+            for (int i = 1; i < n; i++)
+                ok &= set_reg(&mem_map, v[0] + (i - 1) * 4, v[i]);
+            break;
+        case MAP_I2C:
+            if (n != 3 || v[0] > 0xff)
+                goto bad;
+            i2c_devs[v[0]] = true;
+            ok &= set_reg(&i2c_map, i2c_key(v[0], v[1]), v[2]);
+            break;
+        case MAP_SPI:
+            if (n != 2)
+                goto bad;
+            ok &= set_reg(&spi_map, v[0], v[1]);
+            break;
+        }
+        continue;
+    bad:
+        fprintf(stderr, "sim: %s:%d: unexpected line\n", path, lineno);
+        ok = false;
+    }
+    fclose(f);
+    return ok;
+}
+
+bool sim_init(const char *dir) {
+    struct stat st;
+    if (stat(dir, &st) || !S_ISDIR(st.st_mode)) {
+        fprintf(stderr, "sim: %s is not a directory\n", dir);
+        return false;
+    }
+    sim_dir = dir;
+    if (!load_map("mem", MAP_MEM) || !load_map("i2c", MAP_I2C) ||
+        !load_map("spi", MAP_SPI)) {
+        sim_dir = NULL;
+        return false;
+    }
+    return true;
+}
+
+bool sim_mem_reg(uint32_t addr, uint32_t *data, enum REG_OPS op) {
+    // addr 0 releases the mapping in mem_reg(), nothing to do here
+    if (!addr)
+        return true;
+    if (op == OP_WRITE)
+        return set_reg(&mem_map, addr, *data);
+    struct sim_reg *r = find_reg(&mem_map, addr);
+    *data = r ? r->value : 0;
+    return true;
+}
+
+static int sim_open_i2c(int adapter_nr) {
+    (void)adapter_nr;
+    return SIM_FD;
+}
+
+static int sim_open_spi() { return spi_map.n ? SIM_FD : -1; }
+
+static bool sim_close(int fd) {
+    (void)fd;
+    return true;
+}
+
+static int sim_change_addr(int fd, unsigned char addr) {
+    (void)fd;
+    (void)addr;
+    return 0;
+}
+
+// Byte stream the bus would return, LSB first as the universal HAL packs it
+static int read_bytes(const struct regmap *m, uint32_t key,
+                      unsigned int data_width) {
+    int data = 0;
+    for (unsigned int i = 0; i < data_width && i < 4; i++) {
+        struct sim_reg *r = find_reg(m, key + i);
+        data |= (r ? r->value & 0xff : 0) << 8 * i;
+    }
+    return data;
+}
+
+static int sim_i2c_read(int fd, unsigned char i2c_addr, unsigned int reg_addr,
+                        unsigned int reg_width, unsigned int data_width) {
+    (void)fd;
+    (void)reg_width;
+    if (!i2c_devs[i2c_addr])
+        return -1;
+    return read_bytes(&i2c_map, i2c_key(i2c_addr, reg_addr), data_width);
+}
+
+static int sim_i2c_write(int fd, unsigned char i2c_addr, unsigned int reg_addr,
+                         unsigned int reg_width, unsigned int data,
+                         unsigned int data_width) {
+    (void)fd;
+    (void)reg_width;
+    (void)data_width;
+    if (!i2c_devs[i2c_addr])
+        return -1;
+    return set_reg(&i2c_map, i2c_key(i2c_addr, reg_addr), data & 0xff) ? 0
+                                                                       : -1;
+}
+
+static int sim_spi_read(int fd, unsigned char i2c_addr, unsigned int reg_addr,
+                        unsigned int reg_width, unsigned int data_width) {
+    (void)fd;
+    (void)i2c_addr;
+    (void)reg_width;
+    return read_bytes(&spi_map, reg_addr, data_width);
+}
+
+static int sim_spi_write(int fd, unsigned char i2c_addr, unsigned int reg_addr,
+                         unsigned int reg_width, unsigned int data,
+                         unsigned int data_width) {
+    (void)fd;
+    (void)i2c_addr;
+    (void)reg_width;
+    (void)data_width;
+    return set_reg(&spi_map, reg_addr, data & 0xff) ? 0 : -1;
+}
+
+void sim_wrap_hal(void) {
+    if (!sim_dir)
+        return;
+    open_i2c_sensor_fd = sim_open_i2c;
+    open_spi_sensor_fd = sim_open_spi;
+    close_sensor_fd = sim_close;
+    i2c_change_addr = sim_change_addr;
+    i2c_read_register = sim_i2c_read;
+    i2c_write_register = sim_i2c_write;
+    spi_read_register = sim_spi_read;
+    spi_write_register = sim_spi_write;
+}
+
+static bool under(const char *path, const char *dir) {
+    size_t len = strlen(dir);
+    return !strncmp(path, dir, len) && (!path[len] || path[len] == '/');
+}
+
+const char *sim_path(const char *path, char *buf, size_t len) {
+    if (!sim_dir || !path)
+        return path;
+    if (!under(path, "/proc") && !under(path, "/sys") && !under(path, "/dev"))
+        return path;
+    snprintf(buf, len, "%s/root%s", sim_dir, path);
+    return buf;
+}
+
+#define MAX_MTD_FDS 256
+
+static struct {
+    dev_t dev;
+    ino_t ino;
+    int nr;
+} mtd_fds[MAX_MTD_FDS];
+
+void sim_track_fd(int fd, const char *path) {
+    int nr, end = 0;
+    struct stat st;
+    if (fd < 0 || fd >= MAX_MTD_FDS ||
+        sscanf(path, "/dev/mtd%d%n", &nr, &end) != 1 || path[end] ||
+        fstat(fd, &st))
+        return;
+    mtd_fds[fd].dev = st.st_dev;
+    mtd_fds[fd].ino = st.st_ino;
+    mtd_fds[fd].nr = nr + 1;
+}
+
+// erase block size from the simulated /proc/mtd
+static uint32_t mtd_erasesize(int nr) {
+    char buf[PATH_MAX], line[160];
+    FILE *f = fopen(sim_path("/proc/mtd", buf, sizeof(buf)), "r");
+    uint32_t size = 0x10000;
+    int i;
+    unsigned int sz, es;
+    while (f && fgets(line, sizeof(line), f))
+        if (sscanf(line, "mtd%d: %x %x", &i, &sz, &es) == 3 && i == nr)
+            size = es;
+    if (f)
+        fclose(f);
+    return size;
+}
+
+static bool mtd_is_nand(int nr) {
+    char buf[PATH_MAX], path[64], type[16] = "";
+    snprintf(path, sizeof(path), "/sys/class/mtd/mtd%d/type", nr);
+    FILE *f = fopen(sim_path(path, buf, sizeof(buf)), "r");
+    if (f) {
+        if (!fgets(type, sizeof(type), f))
+            *type = '\0';
+        fclose(f);
+    }
+    return !strncmp(type, "nand", 4);
+}
+
+static int mtd_erase(int fd, const struct erase_info_user *ei) {
+    char ff[4096];
+    memset(ff, 0xff, sizeof(ff));
+    for (uint32_t done = 0; done < ei->length;) {
+        size_t n = MIN(sizeof(ff), ei->length - done);
+        if (pwrite(fd, ff, n, ei->start + done) != (ssize_t)n)
+            return -1;
+        done += n;
+    }
+    return 0;
+}
+
+bool sim_mtd_ioctl(int fd, unsigned long request, void *arg, int *ret) {
+    struct stat st;
+    if (!sim_dir || fd < 0 || fd >= MAX_MTD_FDS || !mtd_fds[fd].nr ||
+        fstat(fd, &st) || st.st_dev != mtd_fds[fd].dev ||
+        st.st_ino != mtd_fds[fd].ino)
+        return false;
+
+    int nr = mtd_fds[fd].nr - 1;
+    *ret = 0;
+    switch (request) {
+    case MEMGETINFO: {
+        struct mtd_info_user *mi = arg;
+        bool nand = mtd_is_nand(nr);
+        memset(mi, 0, sizeof(*mi));
+        mi->type = nand ? MTD_NANDFLASH : MTD_NORFLASH;
+        mi->flags = nand ? MTD_CAP_NANDFLASH : MTD_CAP_NORFLASH;
+        mi->size = st.st_size;
+        mi->erasesize = mtd_erasesize(nr);
+        mi->writesize = nand ? 2048 : 1;
+        mi->oobsize = nand ? 64 : 0;
+        break;
+    }
+    case MEMLOCK:
+    case MEMUNLOCK:
+    case MEMGETBADBLOCK:
+        break;
+    case MEMERASE:
+        *ret = mtd_erase(fd, arg);
+        break;
+    default:
+        errno = ENOTTY;
+        *ret = -1;
+    }
+    return true;
+}
@@ -0,0 +1,53 @@
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "tools.h"
+
+/* Simulated hardware, selected with `ipctool --sim=DIR` or IPCTOOL_SIM=DIR.
+ *
+ * DIR is a captured board profile:
+ *
+ *   DIR/mem     physical registers: `ADDR VALUE [VALUE...]` (consecutive
+ *               words) or `devmem ADDR 32 VALUE` lines, i.e. the output
+ *               of `ipctool reginfo --script`. Unlisted words read as 0,
+ *               writes are kept for the rest of the run
+ *   DIR/i2c     sensor registers: `ADDR REG VALUE` or the
+ *               `ipctool i2cset ADDR REG VALUE` lines printed by
+ *               `ipctool --script i2cdump` (8-bit device address).
+ *               Devices not listed don't answer
+ *   DIR/spi     same for the SPI sensor: `REG VALUE` / `ipctool spiset`
+ *   DIR/root/   files under /proc, /sys and /dev (cpuinfo, iomem, mtd,
+ *               device tree, mtdN / mtdblockN / ubiN_M images, ...).
+ *               open(), fopen(), opendir() and access() on those
+ *               paths go here and nowhere else; stat() and readlink()
+ *               are not redirected
+ *
+ * mem_reg() and the sensor HAL callbacks go through the maps above; path
+ * redirection and MTD ioctls on image files need the ipctool link-time
+ * wrappers in sim_io.c. Accesses cost no simulated latency, so timings
+ * measure ipctool itself and repeat across runs. */
+
+extern const char *sim_dir;
+
+// loads DIR's maps and turns the simulation on
+bool sim_init(const char *dir);
+
+bool sim_mem_reg(uint32_t addr, uint32_t *data, enum REG_OPS op);
+
+// installs the simulated I2C / SPI callbacks over the detected HAL
+void sim_wrap_hal(void);
+
+// `path` itself, or its place under DIR/root for /proc, /sys and /dev
+const char *sim_path(const char *path, char *buf, size_t len);
+
+// remembers `fd` if it is an MTD image opened as /dev/mtdN
+void sim_track_fd(int fd, const char *path);
+
+// emulates MTD ioctls on tracked image fds; false if `fd` isn't one
+bool sim_mtd_ioctl(int fd, unsigned long request, void *arg, int *ret);
+
+#endif /* SIM_H */
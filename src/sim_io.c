@@ -0,0 +1,52 @@
+/* Path redirection for --sim (see sim.h): the ipctool link maps open(),
+ * fopen(), opendir() and access() calls here (-Wl,--wrap=...), so /proc,
+ * /sys and /dev come from the board profile. In the -static build that
+ * includes calls from the libc.a members being linked, e.g. a libc
+ * function that opens a file through open(). stat() and readlink() are
+ * not wrapped; nothing of ours uses them on those trees. MTD ioctls on
+ * the image files are answered in profile_io.c's ioctl() wrapper. */
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+#include "sim.h"
+
+int __real_open(const char *path, int flags, ...);
+FILE *__real_fopen(const char *path, const char *mode);
+DIR *__real_opendir(const char *path);
+int __real_access(const char *path, int mode);
+
+int __wrap_open(const char *path, int flags, ...) {
+    mode_t mode = 0;
+    if (flags & O_CREAT) {
+        va_list ap;
+        va_start(ap, flags);
+        mode = va_arg(ap, int);
+        va_end(ap);
+    }
+    if (!sim_dir)
+        return __real_open(path, flags, mode);
+
+    char buf[PATH_MAX];
+    int fd = __real_open(sim_path(path, buf, sizeof(buf)), flags, mode);
+    sim_track_fd(fd, path);
+    return fd;
+}
+
+FILE *__wrap_fopen(const char *path, const char *mode) {
+    char buf[PATH_MAX];
+    return __real_fopen(sim_path(path, buf, sizeof(buf)), mode);
+}
+
+DIR *__wrap_opendir(const char *path) {
+    char buf[PATH_MAX];
+    return __real_opendir(sim_path(path, buf, sizeof(buf)));
+}
+
+int __wrap_access(const char *path, int mode) {
+    char buf[PATH_MAX];
+    return __real_access(sim_path(path, buf, sizeof(buf)), mode);
+}
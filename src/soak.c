@@ -0,0 +1,394 @@
+/* `ipctool soak` -- sustained-load thermal throttling profiler.
+ *
+ * Short cpubench / membw runs finish before a sealed housing heats up.
+ * soak keeps the SoC loaded for minutes and samples what it does about
+ * it:
+ *
+ *   - CPU load threads, one pinned per core, run the cpubench dependent
+ *     ADD pattern back to back; every chunk yields the core's implied
+ *     clock (over thread CPU time, so sharing a core with the streamer
+ *     or a DDR thread doesn't count), and DVFS or thermal throttling
+ *     shows up as a falling cpu_mhz with no extra probe running
+ *   - DDR load threads memcpy through private buffers; the bytes they
+ *     move per interval are the sustained bandwidth
+ *   - every --interval seconds the sampler also records SoC temperature,
+ *     the kernel's cpufreq view and the PLL headline numbers from
+ *     clocks_build_json()
+ *
+ * The summary compares peak against the median of the last quarter of
+ * the run (sustained / peak ratio) and reports the time and temperature
+ * of the first sample where the implied clock dropped more than
+ * THROTTLE_DROP below the best seen so far.
+ */
+
+#define _GNU_SOURCE
+
+#include <getopt.h>
+#include <math.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "chipid.h"
+#include "cjson/cJSON.h"
+#include "cjson/cYAML.h"
+#include "clocks.h"
+#include "cpubench.h"
+#include "hwinfo.h"
+#include "soak.h"
+#include "tools.h"
+
+#define CHUNK_LOOPS 2500000 // ~50 ms of dep ADD at 900 MHz
+#define DDR_CHUNK (1024 * 1024)
+#define THROTTLE_DROP 0.05
+#define MAX_THREADS 64
+
+struct load {
+    pthread_t tid;
+    int cpu;
+    size_t sz;         // DDR threads only
+    uint32_t last_khz; // CPU threads: implied clock of the last chunk
+};
+
+static volatile sig_atomic_t stop;
+static uint32_t ddr_mb; // MB moved by all DDR threads
+
+static void on_signal(int sig) {
+    (void)sig;
+    stop = 1;
+}
+
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void pin(int cpu) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    sched_setaffinity(0, sizeof(set), &set);
+}
+
+static void *cpu_load(void *arg) {
+    struct load *l = arg;
+    pin(l->cpu);
+    while (!stop) {
+        double mhz = cpubench_dep_add_mhz(CHUNK_LOOPS);
+        if (mhz > 0) {
+            __atomic_store_n(&l->last_khz, (uint32_t)(mhz * 1000),
+                             __ATOMIC_RELAXED);
+            continue;
+        }
+        // No asm patterns on this architecture: plain busy loop
+        for (volatile uint32_t i = 0; i < CHUNK_LOOPS * 16; i++)
+            ;
+    }
+    return NULL;
+}
+
+static void *ddr_load(void *arg) {
+    struct load *l = arg;
+    pin(l->cpu);
+    char *a = mmap(NULL, l->sz * 2, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (a == MAP_FAILED) {
+        fprintf(stderr, "soak: cannot map 2 x %zu MB for DDR load\n",
+                l->sz >> 20);
+        return NULL;
+    }
+    char *b = a + l->sz;
+    memset(a, 1, l->sz * 2);
+
+    size_t off = 0;
+    while (!stop) {
+        memcpy(b + off, a + off, DDR_CHUNK);
+        off = (off + DDR_CHUNK) % l->sz;
+        /* one read plus one write per byte */
+        __atomic_fetch_add(&ddr_mb, 2, __ATOMIC_RELAXED);
+    }
+    munmap(a, l->sz * 2);
+    return NULL;
+}
+
+static double cpu0_cpufreq_mhz(void) {
+    FILE *f =
+        fopen("/sys/devices/system/cpu/cpu0/cpufreq/scaling_cur_freq", "r");
+    if (!f)
+        return 0;
+    unsigned long khz = 0;
+    if (fscanf(f, "%lu", &khz) != 1)
+        khz = 0;
+    fclose(f);
+    return khz / 1000.0;
+}
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Median of the last quarter of the series (at least one sample)
+static double sustained(const double *v, size_t n) {
+    size_t from = n - MAX(n / 4, (size_t)1);
+    double tail[n - from];
+    memcpy(tail, v + from, sizeof(tail));
+    qsort(tail, n - from, sizeof(double), cmp_double);
+    return tail[(n - from) / 2];
+}
+
+static void summarize(cJSON *j_inner, const char *what, const double *v,
+                      size_t n) {
+    double peak = 0;
+    for (size_t i = 0; i < n; i++)
+        peak = MAX(peak, v[i]);
+    if (peak <= 0)
+        return;
+    double s = sustained(v, n);
+    char key[48];
+    snprintf(key, sizeof(key), "peak_%s", what);
+    ADD_PARAM_NUM(key, peak);
+    snprintf(key, sizeof(key), "sustained_%s", what);
+    ADD_PARAM_NUM(key, s);
+    snprintf(key, sizeof(key), "%s_sustained_ratio", what);
+    ADD_PARAM_NUM(key, s / peak);
+}
+
+static void add_thermal(cJSON *j_inner, float temp_start, float temp_max,
+                        bool have_clock, double onset_t, double onset_temp) {
+    if (!isnan(temp_start))
+        ADD_PARAM_NUM("temp_start", temp_start);
+    if (!isnan(temp_max))
+        ADD_PARAM_NUM("temp_max", temp_max);
+    if (!have_clock)
+        return;
+    if (isnan(onset_t)) {
+        ADD_PARAM("throttle_onset_s", "none");
+        return;
+    }
+    ADD_PARAM_NUM("throttle_onset_s", onset_t);
+    if (!isnan(onset_temp))
+        ADD_PARAM_NUM("throttle_onset_temp", onset_temp);
+}
+
+static void print_soak_usage(void) {
+    printf("Usage: ipctool soak [--duration S] [--interval S] [--cpu N] "
+           "[--ddr N]\n"
+           "                    [--size MB] [--json]\n"
+           "\n"
+           "Keep the SoC under sustained CPU / DDR load and sample implied "
+           "CPU\n"
+           "clock, PLL settings, DDR bandwidth and temperature at fixed\n"
+           "intervals; summarize throttling onset and sustained vs peak.\n"
+           "\n"
+           "  --duration S  run time (default: 600, Ctrl-C stops early)\n"
+           "  --interval S  sampling interval (default: 10)\n"
+           "  --cpu N       CPU load threads (default: one per online core)\n"
+           "  --ddr N       DDR load threads (default: 1)\n"
+           "  --size MB     buffer per DDR thread (default: 8)\n"
+           "  --json        machine-readable JSON instead of YAML\n");
+}
+
+int soak_cmd(int argc, char **argv) {
+    unsigned duration = 600, interval = 10;
+    int ncpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (ncpus < 1)
+        ncpus = 1;
+    int cpu_threads = ncpus, ddr_threads = 1;
+    size_t mb = 8;
+    bool want_json = false;
+
+    const struct option long_options[] = {
+        {"duration", required_argument, NULL, 'd'},
+        {"interval", required_argument, NULL, 'i'},
+        {"cpu", required_argument, NULL, 'c'},
+        {"ddr", required_argument, NULL, 'm'},
+        {"size", required_argument, NULL, 's'},
+        {"json", no_argument, NULL, 'j'},
+        {"help", no_argument, NULL, 'h'},
+        {NULL, 0, NULL, 0},
+    };
+    int opt;
+    optind = 1;
+    while ((opt = getopt_long(argc, argv, "d:i:c:m:s:jh", long_options,
+                              NULL)) != -1) {
+        switch (opt) {
+        case 'd':
+            duration = strtoul(optarg, NULL, 10);
+            break;
+        case 'i':
+            interval = strtoul(optarg, NULL, 10);
+            break;
+        case 'c':
+            cpu_threads = atoi(optarg);
+            break;
+        case 'm':
+            ddr_threads = atoi(optarg);
+            break;
+        case 's':
+            mb = strtoul(optarg, NULL, 10);
+            break;
+        case 'j':
+            want_json = true;
+            break;
+        case 'h':
+            print_soak_usage();
+            return EXIT_SUCCESS;
+        default:
+            print_soak_usage();
+            return EXIT_FAILURE;
+        }
+    }
+    if (!duration || !interval || interval > duration) {
+        fprintf(stderr, "soak: need 0 < --interval <= --duration\n");
+        return EXIT_FAILURE;
+    }
+    if (cpu_threads < 0 || ddr_threads < 0 ||
+        cpu_threads + ddr_threads > MAX_THREADS ||
+        cpu_threads + ddr_threads == 0) {
+        fprintf(stderr, "soak: need 1..%d load threads in total\n",
+                MAX_THREADS);
+        return EXIT_FAILURE;
+    }
+    if (mb < 1 || mb > 1024) {
+        fprintf(stderr, "soak: --size must be 1..1024 MB\n");
+        return EXIT_FAILURE;
+    }
+
+    getchipname();
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+
+    static struct load loads[MAX_THREADS];
+    int nloads = 0;
+    for (int i = 0; i < cpu_threads + ddr_threads; i++) {
+        struct load *l = &loads[i];
+        bool cpu = i < cpu_threads;
+        l->cpu = i % ncpus;
+        l->sz = mb << 20;
+        if (pthread_create(&l->tid, NULL, cpu ? cpu_load : ddr_load, l)) {
+            fprintf(stderr, "soak: cannot start load thread %d\n", i);
+            stop = 1;
+            break;
+        }
+        nloads++;
+    }
+
+    size_t max_samples = duration / interval;
+    double *mhz = calloc(max_samples, sizeof(double));
+    double *bw = calloc(max_samples, sizeof(double));
+    cJSON *samples = cJSON_CreateArray();
+    size_t n = 0;
+
+    double t0 = now_sec(), last = t0;
+    uint32_t last_mb = __atomic_load_n(&ddr_mb, __ATOMIC_RELAXED);
+    double best = 0, onset_t = NAN, onset_temp = NAN;
+    float temp_start = gethwtemp(), temp_max = temp_start;
+
+    while (!stop && mhz && bw && n < max_samples) {
+        double next = t0 + (n + 1) * (double)interval;
+        while (!stop && now_sec() < next)
+            usleep(100000);
+        if (stop)
+            break;
+
+        double now = now_sec();
+        uint32_t cur_mb = __atomic_load_n(&ddr_mb, __ATOMIC_RELAXED);
+        double sum = 0, lo = 0;
+        for (int i = 0; i < MIN(cpu_threads, nloads); i++) {
+            double m = __atomic_load_n(&loads[i].last_khz,
+                                       __ATOMIC_RELAXED) / 1000.0;
+            sum += m;
+            lo = i ? MIN(lo, m) : m;
+        }
+        mhz[n] = cpu_threads ? sum / MIN(cpu_threads, nloads) : 0;
+        bw[n] = (cur_mb - last_mb) * 1.048576 / (now - last);
+        last = now;
+        last_mb = cur_mb;
+        float temp = gethwtemp();
+
+        cJSON *j_inner = cJSON_CreateObject();
+        ADD_PARAM_NUM("t", round(now - t0));
+        if (!isnan(temp)) {
+            ADD_PARAM_NUM("temp", temp);
+            if (isnan(temp_max) || temp > temp_max)
+                temp_max = temp;
+        }
+        if (mhz[n] > 0) {
+            ADD_PARAM_NUM("cpu_mhz", mhz[n]);
+            ADD_PARAM_NUM("cpu_mhz_min", lo);
+        }
+        double kernel_mhz = cpu0_cpufreq_mhz();
+        if (kernel_mhz)
+            ADD_PARAM_NUM("cpufreq_mhz", kernel_mhz);
+        if (ddr_threads)
+            ADD_PARAM_NUM("ddr_mb_per_sec", bw[n]);
+        cJSON *clocks = clocks_build_json(true);
+        if (clocks)
+            cJSON_AddItemToObject(j_inner, "clocks", clocks);
+        cJSON_AddItemToArray(samples, j_inner);
+
+        fprintf(stderr, "[%6.0f s]", now - t0);
+        if (mhz[n] > 0)
+            fprintf(stderr, " cpu %4.0f MHz (min %4.0f)", mhz[n], lo);
+        if (ddr_threads)
+            fprintf(stderr, " ddr %6.0f MB/s", bw[n]);
+        if (!isnan(temp))
+            fprintf(stderr, " %.1f C", temp);
+        fputc('\n', stderr);
+
+        if (isnan(onset_t) && mhz[n] > 0 &&
+            mhz[n] < best * (1 - THROTTLE_DROP)) {
+            onset_t = round(now - t0);
+            onset_temp = temp;
+        }
+        best = MAX(best, mhz[n]);
+        n++;
+    }
+
+    stop = 1;
+    for (int i = 0; i < nloads; i++)
+        pthread_join(loads[i].tid, NULL);
+
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM_NUM("duration_s", round(now_sec() - t0));
+    ADD_PARAM_NUM("interval_s", interval);
+    ADD_PARAM_NUM("cpu_threads", cpu_threads);
+    ADD_PARAM_NUM("ddr_threads", ddr_threads);
+    const char *chip = getchipname();
+    if (chip)
+        ADD_PARAM("chip", chip);
+
+    cJSON *summary = cJSON_CreateObject();
+    if (n) {
+        summarize(summary, "cpu_mhz", mhz, n);
+        summarize(summary, "ddr_mb_per_sec", bw, n);
+        add_thermal(summary, temp_start, temp_max, best > 0, onset_t,
+                    onset_temp);
+    }
+    cJSON_AddItemToObject(j_inner, "summary", summary);
+    cJSON_AddItemToObject(j_inner, "samples", samples);
+    free(mhz);
+    free(bw);
+
+    cJSON *root = cJSON_CreateObject();
+    cJSON_AddItemToObject(root, "soak", j_inner);
+    char *out = want_json ? cJSON_Print(root) : cYAML_Print(root);
+    if (out) {
+        printf("%s", out);
+        if (want_json)
+            printf("\n");
+        free(out);
+    }
+    cJSON_Delete(root);
+    return n ? EXIT_SUCCESS : EXIT_FAILURE;
+}
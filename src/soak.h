@@ -0,0 +1,6 @@
+#ifndef SOAK_H
+#define SOAK_H
+
+int soak_cmd(int argc, char **argv);
+
+#endif /* SOAK_H */
@@ -11,10 +11,13 @@
 #include <unistd.h>
 
 #include "mmap.h"
+#include "profile.h"
+#include "sim.h"
 #include "tools.h"
 
 #define MAX_ERROR_MSG 0x1000
 int regex_compile(regex_t *r, const char *regex_text) {
+    PROF_COUNT(PROF_REGEX, 1);
     int status = regcomp(r, regex_text, REG_EXTENDED | REG_NEWLINE);
     if (status != 0) {
         char error_message[MAX_ERROR_MSG];
@@ -34,6 +37,9 @@ bool mem_reg(uint32_t addr, uint32_t *data, enum REG_OPS op) {
     static uint32_t loaded_offset;
     static uint32_t loaded_size;
 
+    PROF_COUNT(PROF_MEM_REG, 1);
+    if (sim_dir)
+        return sim_mem_reg(addr, data, op);
     // do nothing if no pinmux for this GPIO
     if (addr == 0xdeadbeef) {
         if (op == OP_READ)
@@ -152,6 +158,7 @@ bool dts_items_by_regex(const char *filename, const char *re, char *outbuf,
     char *text = malloc(fsize + 1);
     int ret = fread(text, 1, fsize, f);
     text[fsize] = 0;
+    PROF_COUNT(PROF_READ_BYTES, fsize);
 
     for (int i = 0; i < fsize; i++) {
         if (text[i] == 0)
@@ -196,7 +203,9 @@ bool line_from_file(const char *filename, const char *re, char *outbuf,
     char *line = NULL;
     size_t len = 0;
 
-    while (getline(&line, &len, f) != -1) {
+    ssize_t n;
+    while ((n = getline(&line, &len, f)) != -1) {
+        PROF_COUNT(PROF_READ_BYTES, n);
         if (regexec(&regex, line, ARRCNT(matches), matches, 0) == 0) {
             regoff_t start = matches[1].rm_so;
             regoff_t end = matches[1].rm_eo;
@@ -247,6 +256,7 @@ char *fread_to_buf(const char *filename, size_t *bs, uint32_t round_up,
         return NULL;
 
     len = fread(buf, 1, len, fp);
+    PROF_COUNT(PROF_READ_BYTES, len);
     memset(buf + len, 0xff, *bs - len);
     fclose(fp);
 
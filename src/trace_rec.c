@@ -0,0 +1,259 @@
+#include <errno.h>
+#include <getopt.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "tools.h"
+#include "trace_rec.h"
+#include "trace_timeline.h"
+
+// flushed with one write() when full, so a tracee stop rarely costs one
+static unsigned char wbuf[64 * 1024];
+static size_t wlen;
+static int wfd = -1;
+
+bool trace_rec_flush(void) {
+    size_t done = 0;
+    while (done < wlen) {
+        ssize_t n = write(wfd, wbuf + done, wlen - done);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0) {
+            fprintf(stderr, "trace: capture write failed (%s)\n",
+                    strerror(errno));
+            wlen = 0;
+            return false;
+        }
+        done += n;
+    }
+    wlen = 0;
+    return true;
+}
+
+static void wbuf_add(const void *data, size_t len) {
+    const unsigned char *p = data;
+    while (len) {
+        if (wlen == sizeof(wbuf))
+            trace_rec_flush();
+        size_t n = MIN(len, sizeof(wbuf) - wlen);
+        memcpy(wbuf + wlen, p, n);
+        wlen += n;
+        p += n;
+        len -= n;
+    }
+}
+
+bool trace_rec_open(int fd) {
+    struct trace_file_hdr hdr = {
+        .version = TRACE_VERSION,
+        .rec_size = sizeof(struct trace_rec),
+    };
+    memcpy(hdr.magic, TRACE_MAGIC, sizeof(hdr.magic));
+    wfd = fd;
+    wlen = 0;
+    wbuf_add(&hdr, sizeof(hdr));
+    return trace_rec_flush();
+}
+
+void trace_rec_write(const struct trace_rec *r, const void *payload) {
+    wbuf_add(r, sizeof(*r));
+    if (r->len)
+        wbuf_add(payload, r->len);
+}
+
+static const char *const fd_class_names[] = {
+    [TRACE_FD_NONE] = "none", [TRACE_FD_I2C] = "i2c", [TRACE_FD_SPI] = "spi",
+    [TRACE_FD_SSP] = "ssp",   [TRACE_FD_MIPI] = "mipi", [TRACE_FD_VI] = "vi",
+    [TRACE_FD_MTD] = "mtd",   [TRACE_FD_GPIO] = "gpio",
+    [TRACE_FD_OTHER] = "other",
+};
+
+const char *trace_fd_class_name(enum trace_fd_class c) {
+    if ((size_t)c < ARRCNT(fd_class_names) && fd_class_names[c])
+        return fd_class_names[c];
+    return "unknown";
+}
+
+static const char *const op_names[] = {
+    [TRACE_TEXT] = "text",
+    [TRACE_I2C_ADDR] = "i2c_change_addr",
+    [TRACE_REG_WRITE] = "write_register",
+    [TRACE_REG_READ] = "read_register",
+    [TRACE_USLEEP] = "usleep",
+};
+
+// register ops on the SSP bus keep their own function names
+static const char *reg_prefix(const struct trace_rec *r) {
+    return r->fd_class == TRACE_FD_SSP ? "ssp" : "sensor";
+}
+
+void trace_rec_print(FILE *f, const struct trace_rec *r, const void *payload) {
+    switch (r->op) {
+    case TRACE_TEXT:
+        fwrite(payload, 1, r->len, f);
+        break;
+    case TRACE_I2C_ADDR:
+        fprintf(f, "sensor_i2c_change_addr(0x%x);\n", r->a);
+        break;
+    case TRACE_REG_WRITE:
+        fprintf(f, "%s_write_register(0x%x, 0x%x);\n", reg_prefix(r), r->a,
+                r->b);
+        break;
+    case TRACE_REG_READ:
+        fprintf(f, "%s_read_register(0x%x); /* ", reg_prefix(r), r->a);
+        if (r->ret >= 0)
+            fprintf(f, "-> 0x%x", r->b);
+        else
+            fprintf(f, "[err]");
+        fprintf(f, " */\n");
+        break;
+    case TRACE_USLEEP:
+        fprintf(f, "usleep(%u)\n", r->a);
+        break;
+    }
+}
+
+cJSON *trace_rec_json(const struct trace_rec *r, const void *payload) {
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM_NUM("ts_ns", r->ts_ns);
+    ADD_PARAM_NUM("tid", r->tid);
+    if (r->syscall)
+        ADD_PARAM_NUM("syscall", r->syscall);
+    if (r->fd_class != TRACE_FD_NONE)
+        ADD_PARAM("fd_class", trace_fd_class_name(r->fd_class));
+    ADD_PARAM("op", r->op < ARRCNT(op_names) ? op_names[r->op] : "unknown");
+    switch (r->op) {
+    case TRACE_TEXT: {
+        char *text = strndup(payload, r->len);
+        ADD_PARAM("text", text);
+        free(text);
+        break;
+    }
+    case TRACE_I2C_ADDR:
+        ADD_PARAM_NUM("addr", r->a);
+        break;
+    case TRACE_REG_WRITE:
+        ADD_PARAM_NUM("reg", r->a);
+        ADD_PARAM_NUM("value", r->b);
+        break;
+    case TRACE_REG_READ:
+        ADD_PARAM_NUM("reg", r->a);
+        if (r->ret >= 0)
+            ADD_PARAM_NUM("value", r->b);
+        break;
+    case TRACE_USLEEP:
+        ADD_PARAM_NUM("us", r->a);
+        break;
+    }
+    ADD_PARAM_NUM("ret", r->ret);
+    if (r->dur_us)
+        ADD_PARAM_NUM("dur_us", r->dur_us);
+    return j_inner;
+}
+
+static void print_decode_usage(void) {
+    printf("Usage: ipctool trace-decode [--json|--timeline] [FILE]\n"
+           "  Prints an `ipctool trace --binary` capture (FILE or stdin) as\n"
+           "  the pseudocode `ipctool trace` would have printed, with\n"
+           "  --json as one JSON object per record, or with --timeline as a\n"
+           "  Chrome trace of the startup phases\n");
+}
+
+int trace_decode_cmd(int argc, char **argv) {
+    bool json = false, timeline = false;
+    const struct option long_options[] = {
+        {"json", no_argument, NULL, 'j'},
+        {"timeline", no_argument, NULL, 't'},
+        {"help", no_argument, NULL, 'h'},
+        {NULL, 0, NULL, 0},
+    };
+    int opt;
+    optind = 1;
+    while ((opt = getopt_long(argc, argv, "jth", long_options, NULL)) != -1) {
+        switch (opt) {
+        case 'j':
+            json = true;
+            break;
+        case 't':
+            timeline = true;
+            break;
+        case 'h':
+            print_decode_usage();
+            return EXIT_SUCCESS;
+        default:
+            print_decode_usage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    const char *path = optind < argc ? argv[optind] : "-";
+    FILE *f = strcmp(path, "-") ? fopen(path, "rb") : stdin;
+    if (!f) {
+        fprintf(stderr, "trace-decode: %s: %s\n", path, strerror(errno));
+        return EXIT_FAILURE;
+    }
+
+    struct trace_file_hdr hdr;
+    const char *err = NULL;
+    if (fread(&hdr, sizeof(hdr), 1, f) != 1 ||
+        memcmp(hdr.magic, TRACE_MAGIC, sizeof(hdr.magic)))
+        err = "is not a trace capture";
+    else if (hdr.version != TRACE_VERSION)
+        err = "is from an incompatible ipctool version";
+    else if (hdr.rec_size < TRACE_REC_MIN_SIZE)
+        err = "has records shorter than any known layout";
+    if (err) {
+        fprintf(stderr, "trace-decode: %s %s\n", path, err);
+        if (f != stdin)
+            fclose(f);
+        return EXIT_FAILURE;
+    }
+
+    // fields an older writer did not have stay zero
+    struct trace_rec r = {0};
+    size_t rec_size = MIN(hdr.rec_size, sizeof(r));
+    char *payload = NULL;
+    size_t cap = 0;
+    int ret = EXIT_SUCCESS;
+    while (fread(&r, rec_size, 1, f) == 1) {
+        // header fields appended by newer writers
+        for (size_t extra = hdr.rec_size - rec_size; extra; extra--)
+            fgetc(f);
+        if (r.len > cap) {
+            cap = r.len;
+            payload = realloc(payload, cap);
+            if (!payload) {
+                ret = EXIT_FAILURE;
+                break;
+            }
+        }
+        if (r.len && fread(payload, r.len, 1, f) != 1) {
+            fprintf(stderr, "trace-decode: %s: truncated record\n", path);
+            ret = EXIT_FAILURE;
+            break;
+        }
+        if (timeline) {
+            timeline_add(&r);
+        } else if (json) {
+            cJSON *j = trace_rec_json(&r, payload);
+            char *s = cJSON_PrintUnformatted(j);
+            puts(s);
+            free(s);
+            cJSON_Delete(j);
+        } else {
+            trace_rec_print(stdout, &r, payload);
+        }
+    }
+    free(payload);
+    if (f != stdin)
+        fclose(f);
+    if (timeline && ret == EXIT_SUCCESS) {
+        cJSON *j = timeline_json();
+        char *s = cJSON_Print(j);
+        puts(s);
+        free(s);
+        cJSON_Delete(j);
+    }
+    return ret;
+}
@@ -0,0 +1,80 @@
+#ifndef TRACE_REC_H
+#define TRACE_REC_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "cjson/cJSON.h"
+
+/* Binary capture written by `ipctool trace --binary` and turned back into
+ * pseudocode or JSON by `ipctool trace-decode`, on the camera or on a PC.
+ *
+ * A capture is a struct trace_file_hdr followed by records: a fixed
+ * struct trace_rec and then `len` payload bytes. Fields are in the
+ * tracer's byte order, little-endian on every supported SoC. Fields are
+ * only ever appended to the record: readers zero the ones a shorter
+ * record lacks and skip bytes beyond the struct they know. */
+
+#define TRACE_MAGIC "IPCTRACE"
+#define TRACE_VERSION 1
+
+struct trace_file_hdr {
+    char magic[8];
+    uint32_t version;
+    uint32_t rec_size; // sizeof(struct trace_rec) of the writer
+};
+
+// what the record's fd was opened as
+enum trace_fd_class {
+    TRACE_FD_NONE,
+    TRACE_FD_I2C,
+    TRACE_FD_SPI,
+    TRACE_FD_SSP,
+    TRACE_FD_MIPI,
+    TRACE_FD_VI,
+    TRACE_FD_MTD,
+    TRACE_FD_GPIO,
+    TRACE_FD_OTHER,
+};
+
+enum trace_op {
+    TRACE_TEXT,      // payload: pseudocode exactly as printed
+    TRACE_I2C_ADDR,  // a: sensor address (8-bit)
+    TRACE_REG_WRITE, // a: register, b: value
+    TRACE_REG_READ,  // a: register, b: value, unless ret < 0
+    TRACE_USLEEP,    // a: microseconds
+};
+
+struct trace_rec {
+    uint64_t ts_ns;   // CLOCK_MONOTONIC at the tracee stop
+    uint32_t tid;     // 0 for the tracer's own messages
+    uint16_t syscall; // ARM EABI number, 0 outside a syscall
+    uint8_t fd_class; // enum trace_fd_class
+    uint8_t op;       // enum trace_op
+    uint32_t a, b;
+    int32_t ret; // syscall return value
+    uint32_t len;
+    uint32_t dur_us; // syscall entry to exit, 0 if not timed
+    uint32_t reserved;
+};
+
+// the first layout, without dur_us
+#define TRACE_REC_MIN_SIZE offsetof(struct trace_rec, dur_us)
+
+// starts a capture on `fd`, writing the file header
+bool trace_rec_open(int fd);
+// appends a record to the write buffer, flushing it when full
+void trace_rec_write(const struct trace_rec *r, const void *payload);
+bool trace_rec_flush(void);
+
+// the pseudocode `ipctool trace` prints for the record
+void trace_rec_print(FILE *f, const struct trace_rec *r, const void *payload);
+cJSON *trace_rec_json(const struct trace_rec *r, const void *payload);
+
+const char *trace_fd_class_name(enum trace_fd_class c);
+
+int trace_decode_cmd(int argc, char **argv);
+
+#endif /* TRACE_REC_H */
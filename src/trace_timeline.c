@@ -0,0 +1,321 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tools.h"
+#include "trace_timeline.h"
+
+// ARM EABI ioctl(), as in ptrace.c
+#define SYSCALL_IOCTL 54
+// register ops closer than this on one thread draw as one bus slice
+#define BURST_GAP_NS 1000000
+// trace_segment.py's RUNTIME_REPEAT_THRESHOLD
+#define RUNTIME_REPEAT_THRESHOLD 3
+// startup fits many times over; later events are dropped
+#define MAX_EVENTS (256 * 1024)
+#define MAX_PHASES 16
+
+enum tl_kind { TL_WRITE, TL_READ, TL_SLEEP, TL_MIPI, TL_VI };
+
+struct tl_event {
+    uint64_t start_ns, end_ns;
+    uint32_t tid;
+    uint32_t a, b; // register and value, or usleep() argument
+    uint8_t kind;
+    bool ok;
+};
+
+static struct tl_event *events;
+static size_t n_events, cap_events;
+static bool truncated;
+
+void timeline_add(const struct trace_rec *r) {
+    struct tl_event e = {
+        .end_ns = r->ts_ns,
+        .tid = r->tid,
+        .a = r->a,
+        .b = r->b,
+        .ok = r->ret >= 0,
+    };
+    e.start_ns = r->ts_ns - MIN((uint64_t)r->dur_us * 1000, r->ts_ns);
+    switch (r->op) {
+    case TRACE_REG_WRITE:
+        e.kind = TL_WRITE;
+        break;
+    case TRACE_REG_READ:
+        e.kind = TL_READ;
+        break;
+    case TRACE_USLEEP:
+        e.kind = TL_SLEEP;
+        break;
+    case TRACE_TEXT:
+        if (r->syscall != SYSCALL_IOCTL)
+            return;
+        if (r->fd_class == TRACE_FD_MIPI)
+            e.kind = TL_MIPI;
+        else if (r->fd_class == TRACE_FD_VI)
+            e.kind = TL_VI;
+        else
+            return;
+        break;
+    default:
+        return;
+    }
+
+    if (n_events == cap_events) {
+        size_t cap = cap_events ? cap_events * 2 : 4096;
+        struct tl_event *p = cap <= MAX_EVENTS
+                                 ? realloc(events, cap * sizeof(*p))
+                                 : NULL;
+        if (!p) {
+            truncated = true;
+            return;
+        }
+        events = p;
+        cap_events = cap;
+    }
+    events[n_events++] = e;
+}
+
+// trace_segment.py's INIT_PATTERNS: stream-control register, the value
+// that halts the sensor for init and the one that starts streaming
+static const struct {
+    const char *name;
+    uint32_t reg, init_val, stream_val;
+} init_patterns[] = {
+    {"smartsens", 0x100, 0, 1},
+    {"sony_imx", 0x3000, 1, 0},
+    {"soi_jx", 0x12, 0x40, 0x00},
+};
+
+// first write of `val` to `reg` at or after `from`, n_events if none
+static size_t find_write(size_t from, uint32_t reg, uint32_t val) {
+    for (size_t i = from; i < n_events; i++)
+        if (events[i].kind == TL_WRITE && events[i].a == reg &&
+            events[i].b == val)
+            return i;
+    return n_events;
+}
+
+struct phase {
+    char name[24];
+    size_t first; // runs up to the next phase's first event
+};
+
+static struct phase phases[MAX_PHASES];
+static int n_phases;
+
+static void add_phase(const char *name, size_t first) {
+    if (n_phases == MAX_PHASES || first >= n_events)
+        return;
+    snprintf(phases[n_phases].name, sizeof(phases[0].name), "%s", name);
+    phases[n_phases++].first = first;
+}
+
+// index of the first write to a register rewritten per frame after `from`
+static size_t find_runtime(size_t from) {
+    uint8_t *count = calloc(0x10000, 1);
+    if (!count)
+        return n_events;
+    for (size_t i = from; i < n_events; i++)
+        if (events[i].kind == TL_WRITE && count[events[i].a & 0xffff] < 255)
+            count[events[i].a & 0xffff]++;
+    size_t i = from;
+    while (i < n_events &&
+           (events[i].kind != TL_WRITE ||
+            count[events[i].a & 0xffff] < RUNTIME_REPEAT_THRESHOLD))
+        i++;
+    free(count);
+    return i;
+}
+
+static const char *find_phases(void) {
+    size_t n = n_events, init_s = n, init_e = n;
+    int pat = -1;
+    for (size_t p = 0; p < ARRCNT(init_patterns) && pat < 0; p++) {
+        init_s = find_write(0, init_patterns[p].reg, init_patterns[p].init_val);
+        if (init_s == n)
+            continue;
+        pat = p;
+        // init started but never streamed: the tail is all init
+        init_e = find_write(init_s + 1, init_patterns[p].reg,
+                            init_patterns[p].stream_val);
+        if (init_e == n)
+            init_e = n - 1;
+    }
+
+    size_t first_cfg = 0;
+    while (first_cfg < init_s && events[first_cfg].kind != TL_MIPI &&
+           events[first_cfg].kind != TL_VI)
+        first_cfg++;
+    n_phases = 0;
+    if (first_cfg)
+        add_phase("probe", 0);
+    if (first_cfg < init_s)
+        add_phase("mipi_vi", first_cfg);
+    if (pat < 0)
+        return NULL;
+
+    add_phase("init", init_s);
+    // each later halt / stream-on cycle of the same register
+    size_t last_on = init_e;
+    for (int k = 1;; k++) {
+        size_t s = find_write(last_on + 1, init_patterns[pat].reg,
+                              init_patterns[pat].init_val);
+        size_t e = s < n ? find_write(s + 1, init_patterns[pat].reg,
+                                      init_patterns[pat].stream_val)
+                         : n;
+        if (e == n)
+            break;
+        char name[24];
+        snprintf(name, sizeof(name), "mode_switch_%d", k);
+        add_phase(name, s);
+        last_on = e;
+    }
+    size_t runtime = find_runtime(last_on + 1);
+    if (runtime > last_on + 1)
+        add_phase("post_init", last_on + 1);
+    add_phase("runtime", runtime);
+    return init_patterns[pat].name;
+}
+
+static uint64_t t0;
+
+static double rel_us(uint64_t ns) { return (ns - t0) / 1000.; }
+
+static cJSON *add_slice(cJSON *list, const char *name, const char *cat,
+                        uint64_t start, uint64_t end, int pid, uint32_t tid) {
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM("name", name);
+    ADD_PARAM("cat", cat);
+    ADD_PARAM("ph", "X");
+    ADD_PARAM_NUM("ts", rel_us(start));
+    ADD_PARAM_NUM("dur", (end - start) / 1000.);
+    ADD_PARAM_NUM("pid", pid);
+    ADD_PARAM_NUM("tid", tid);
+    cJSON_AddItemToArray(list, j_inner);
+    cJSON *args = cJSON_CreateObject();
+    cJSON_AddItemToObject(j_inner, "args", args);
+    return args;
+}
+
+static void add_process_name(cJSON *list, int pid, const char *name) {
+    cJSON *j_inner = cJSON_CreateObject();
+    ADD_PARAM("name", "process_name");
+    ADD_PARAM("ph", "M");
+    ADD_PARAM_NUM("pid", pid);
+    cJSON *args = cJSON_CreateObject();
+    cJSON_AddItemToObject(j_inner, "args", args);
+    cJSON_AddItemToArray(list, j_inner);
+    j_inner = args;
+    ADD_PARAM("name", name);
+}
+
+static void add_phase_slices(cJSON *list, uint64_t last_end) {
+    for (int p = 0; p < n_phases; p++) {
+        size_t from = phases[p].first;
+        size_t to = p + 1 < n_phases ? phases[p + 1].first : n_events;
+        uint64_t start = events[from].start_ns;
+        uint64_t end = to < n_events ? events[to].start_ns : last_end;
+        uint64_t bus = 0, sleep = 0, cfg = 0;
+        unsigned writes = 0, reads = 0, failed = 0, sleeps = 0;
+        for (size_t i = from; i < to; i++) {
+            uint64_t d = events[i].end_ns - events[i].start_ns;
+            switch (events[i].kind) {
+            case TL_WRITE:
+                writes++;
+                bus += d;
+                break;
+            case TL_READ:
+                reads++;
+                failed += !events[i].ok;
+                bus += d;
+                break;
+            case TL_SLEEP:
+                sleeps++;
+                sleep += d;
+                break;
+            default:
+                cfg += d;
+            }
+        }
+        end = MAX(end, start);
+        // threads can overlap, so the busy sum may exceed the phase
+        uint64_t busy = bus + sleep + cfg, span = end - start;
+        cJSON *j_inner = add_slice(list, phases[p].name, "phase", start, end,
+                                   0, 0);
+        ADD_PARAM_NUM("reg_writes", writes);
+        ADD_PARAM_NUM("reg_reads", reads);
+        ADD_PARAM_NUM("failed_reads", failed);
+        ADD_PARAM_NUM("usleeps", sleeps);
+        ADD_PARAM_NUM("bus_ms", bus / 1e6);
+        ADD_PARAM_NUM("usleep_ms", sleep / 1e6);
+        ADD_PARAM_NUM("mipi_vi_ms", cfg / 1e6);
+        ADD_PARAM_NUM("gap_ms", busy < span ? (span - busy) / 1e6 : 0);
+    }
+}
+
+static void add_event_slices(cJSON *list) {
+    struct tl_event burst = {0};
+    unsigned writes = 0, reads = 0;
+    for (size_t i = 0; i <= n_events; i++) {
+        const struct tl_event *e = i < n_events ? &events[i] : NULL;
+        bool reg = e && (e->kind == TL_WRITE || e->kind == TL_READ);
+        if (reg && writes + reads && e->tid == burst.tid &&
+            e->start_ns < burst.end_ns + BURST_GAP_NS) {
+            burst.end_ns = MAX(burst.end_ns, e->end_ns);
+            writes += e->kind == TL_WRITE;
+            reads += e->kind == TL_READ;
+            continue;
+        }
+        if (writes + reads) {
+            cJSON *j_inner = add_slice(list, "sensor registers", "bus",
+                                       burst.start_ns, burst.end_ns, 1,
+                                       burst.tid);
+            ADD_PARAM_NUM("writes", writes);
+            ADD_PARAM_NUM("reads", reads);
+            writes = reads = 0;
+        }
+        if (!e)
+            break;
+        if (reg) {
+            burst = *e;
+            writes = e->kind == TL_WRITE;
+            reads = e->kind == TL_READ;
+        } else if (e->kind == TL_SLEEP) {
+            cJSON *j_inner = add_slice(list, "usleep", "sleep", e->start_ns,
+                                       e->end_ns, 1, e->tid);
+            ADD_PARAM_NUM("us", e->a);
+        } else {
+            add_slice(list, e->kind == TL_MIPI ? "mipi ioctl" : "vi ioctl",
+                      "mipi_vi", e->start_ns, e->end_ns, 1, e->tid);
+        }
+    }
+}
+
+cJSON *timeline_json(void) {
+    cJSON *root = cJSON_CreateObject();
+    cJSON *list = cJSON_CreateArray();
+    cJSON_AddItemToObject(root, "traceEvents", list);
+    cJSON_AddItemToObject(root, "displayTimeUnit", cJSON_CreateString("ms"));
+
+    const char *pattern = n_events ? find_phases() : NULL;
+    uint64_t last_end = 0;
+    t0 = n_events ? events[0].start_ns : 0;
+    for (size_t i = 0; i < n_events; i++) {
+        t0 = MIN(t0, events[i].start_ns);
+        last_end = MAX(last_end, events[i].end_ns);
+    }
+
+    add_process_name(list, 0, "startup phases");
+    add_process_name(list, 1, "streamer");
+    add_phase_slices(list, last_end);
+    add_event_slices(list);
+
+    cJSON *j_inner = cJSON_CreateObject();
+    cJSON_AddItemToObject(root, "otherData", j_inner);
+    ADD_PARAM("init_pattern", pattern ? pattern : "none");
+    ADD_PARAM_NUM("events", n_events);
+    cJSON_AddItemToObject(j_inner, "truncated", cJSON_CreateBool(truncated));
+    return root;
+}
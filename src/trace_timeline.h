@@ -0,0 +1,22 @@
+#ifndef TRACE_TIMELINE_H
+#define TRACE_TIMELINE_H
+
+#include "cjson/cJSON.h"
+#include "trace_rec.h"
+
+/* Streamer startup timeline for `ipctool trace --timeline=FILE` and
+ * `ipctool trace-decode --timeline`, as Chrome trace event JSON that
+ * chrome://tracing and ui.perfetto.dev open.
+ *
+ * Phases are cut where tools/trace_segment.py cuts them: the sensor's
+ * stream-control write (0x100 / 0x3000 / 0x12 families) starts and ends
+ * init, later cycles of it are mode switches, and runtime starts at the
+ * first register rewritten every frame. Before init, probe runs until the
+ * first MIPI / VI ioctl, which starts mipi_vi. Each phase reports time on
+ * the sensor bus, in usleep(), in MIPI / VI ioctls and the gaps left. */
+
+// feeds register, usleep and MIPI / VI ioctl records; others are ignored
+void timeline_add(const struct trace_rec *r);
+cJSON *timeline_json(void);
+
+#endif /* TRACE_TIMELINE_H */
@@ -38,7 +38,7 @@ static void init_tables(uint32_t *table, uint32_t *wtable) {
         }
 }
 
-static void crc32(const void *data, size_t n_bytes, uint32_t *crc) {
+void crc32(const void *data, size_t n_bytes, uint32_t *crc) {
     static uint32_t table[0x100], wtable[0x100 * sizeof(accum_t)];
     size_t n_accum = n_bytes / sizeof(accum_t);
     if (!*table)
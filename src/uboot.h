@@ -3,8 +3,12 @@
 
 #define ENV_MTD_NUM 2
 
+#include <stdint.h>
 #include <stdlib.h>
 
+// zlib-compatible CRC-32, updates *crc (start from 0)
+void crc32(const void *data, size_t n_bytes, uint32_t *crc);
+
 int uboot_detect_env(void *buf, size_t size, size_t erasesize);
 const char *uboot_env_get_param(const char *name);
 void uboot_copyenv_int(const void *buf);